@@ -0,0 +1,203 @@
+"""
+Converts the column-major GLCD Font Creator tables in src/Bitmaps into the
+row-major packed font format of lib/display-extern/src/PackedFont.h, either
+as rows of bits or as rows of run lengths.
+
+Runs as a PlatformIO pre script and regenerates a packed header whenever its
+source table or this script is newer. It can also be run by hand:
+
+    python3 fontcompiler.py [project dir]
+"""
+import os
+import re
+import sys
+
+# encodings of PackedFont.h
+BITS = 0
+RUNS = 1
+
+# source table, array name in the source, generated font, encoding
+FONTS = [
+    ('Arial12x12.h', 'Arial12x12', 'Arial12x12_packed', BITS),
+    ('Arial28x28.h', 'Arial28x28', 'Arial28x28_packed', BITS),
+    ('font_big.h', 'Neu42x35', 'Neu42x35_packed', BITS),
+    ('font_big.h', 'Neu42x35', 'Neu42x35_runs', RUNS),
+]
+
+FIRST_CHAR = 32
+
+
+def _read_table(path, name):
+    """
+    Reads the byte array with the given name out of a C header and returns
+    it as a list of ints.
+    """
+    with open(path) as f:
+        source = re.sub(r'//[^\n]*', '', f.read())
+    match = re.search(r'\b' + re.escape(name) + r'\s*\[\s*\]\s*=\s*\{([^}]*)\}', source)
+    if match is None:
+        raise ValueError('no table %s in %s' % (name, path))
+    return [int(token, 0) for token in match.group(1).replace(',', ' ').split()]
+
+
+def _glyph_pixels(table, index):
+    """
+    Returns the pixels of one glyph as rows of bools and the width byte of
+    the glyph. The GLCD layout stores every column as bpl bytes, LSB at the top.
+    """
+    length, hor, vert, bpl = table[0:4]
+    glyph = table[4 + index * length:4 + (index + 1) * length]
+    rows = [[bool(glyph[1 + bpl * x + (y >> 3)] & (1 << (y & 7))) for x in range(hor)]
+            for y in range(vert)]
+    return rows, glyph[0]
+
+
+def _pack_bits(bits):
+    """
+    Packs one row of the bounding box, MSB first, padded to whole bytes.
+    """
+    packed = []
+    for i in range(0, len(bits), 8):
+        byte = 0
+        for j, set_pixel in enumerate(bits[i:i + 8]):
+            if set_pixel:
+                byte |= 0x80 >> j
+        packed.append(byte)
+    return packed
+
+
+def _pack_runs(bits):
+    """
+    Encodes one row of the bounding box as its number of runs followed by the
+    run lengths, alternating background and foreground, starting with background.
+    """
+    runs = []
+    colour = False
+    length = 0
+    for set_pixel in bits:
+        if set_pixel != colour:
+            runs.append(length)
+            colour = set_pixel
+            length = 0
+        length += 1
+    runs.append(length)
+    return [len(runs)] + runs
+
+
+def _pack_glyph(rows, width, hor, encoding):
+    """
+    Trims a glyph to the bounding box of its set pixels and packs the box row
+    by row in the given encoding.
+    Returns (advance, x, y, w, h, bytes).
+    """
+    advance = width + 2 if width + 2 < hor else hor
+    xs = [x for row in rows for x, set_pixel in enumerate(row) if set_pixel]
+    ys = [y for y, row in enumerate(rows) if any(row)]
+    if not xs:
+        return advance, 0, 0, 0, 0, []
+
+    x0, x1 = min(xs), max(xs)
+    y0, y1 = min(ys), max(ys)
+    pack_row = _pack_runs if encoding == RUNS else _pack_bits
+    packed_rows = [pack_row(rows[y][x0:x1 + 1]) for y in range(y0, y1 + 1)]
+    packed = []
+    if encoding == RUNS:
+        # run rows differ in length: a table of 16 bit offsets (little endian, from the
+        # glyph start) finds any row without walking the ones above it
+        offset = 2 * len(packed_rows)
+        for packed_row in packed_rows:
+            packed.extend([offset & 0xFF, offset >> 8])
+            offset += len(packed_row)
+    for packed_row in packed_rows:
+        packed.extend(packed_row)
+    return advance, x0, y0, x1 - x0 + 1, y1 - y0 + 1, packed
+
+
+def _char_name(c):
+    # a backslash at the end of a comment would continue it into the next line
+    return {' ': 'space', '\\': 'backslash', '\x7f': 'DEL'}.get(c, c)
+
+
+def compile_font(source_path, name, output_path, symbol, encoding):
+    """
+    Converts one GLCD table into a packed font header.
+    """
+    table = _read_table(source_path, name)
+    length, hor, vert, bpl = table[0:4]
+    count = (len(table) - 4) // length
+
+    bitmap = []
+    glyphs = []
+    for index in range(count):
+        rows, width = _glyph_pixels(table, index)
+        advance, x, y, w, h, packed = _pack_glyph(rows, width, hor, encoding)
+        glyphs.append((len(bitmap), advance, x, y, w, h, chr(FIRST_CHAR + index)))
+        bitmap.extend(packed)
+
+    if len(bitmap) > 0xFFFF:
+        raise ValueError('%s: bitmap too large for 16 bit glyph offsets' % name)
+
+    guard = '_' + symbol.upper() + '_H_'
+    lines = [
+        '// generated by fontcompiler.py from %s - do not edit' % os.path.basename(source_path),
+        '#ifndef %s' % guard,
+        '#define %s' % guard,
+        '',
+        '#include "PackedFont.h"',
+        '',
+        'const uint8_t %s_bitmap[] = {' % symbol,
+    ]
+    for index, (offset, advance, x, y, w, h, c) in enumerate(glyphs):
+        end = glyphs[index + 1][0] if index + 1 < len(glyphs) else len(bitmap)
+        if end > offset:
+            lines.append('        %s  // %s' % (' '.join('0x%02X,' % b for b in bitmap[offset:end]), _char_name(c)))
+    if not bitmap:
+        lines.append('        0x00')
+    lines += [
+        '};',
+        '',
+        'const packed_glyph_t %s_glyphs[] = {' % symbol,
+    ]
+    for offset, advance, x, y, w, h, c in glyphs:
+        lines.append('        { %5d, %2d, %2d, %2d, %2d, %2d },  // %s' % (offset, advance, x, y, w, h, _char_name(c)))
+    lines += [
+        '};',
+        '',
+        'const packed_font_t %s = { %d, %d, %d, %d, %s, %s_glyphs, %s_bitmap };' % (
+            symbol, FIRST_CHAR, FIRST_CHAR + count - 1, hor, vert,
+            'PACKED_FONT_RUNS' if encoding == RUNS else 'PACKED_FONT_BITS', symbol, symbol),
+        '',
+        '#endif',
+        '',
+    ]
+
+    with open(output_path, 'w') as f:
+        f.write('\n'.join(lines))
+
+
+def compile_fonts(project_dir, force=False):
+    """
+    Regenerates every packed font header which is older than its source table
+    or this script.
+    """
+    bitmaps_dir = os.path.join(project_dir, 'src', 'Bitmaps')
+    script_time = os.path.getmtime(os.path.join(project_dir, 'fontcompiler.py'))
+    for source, name, symbol, encoding in FONTS:
+        output = symbol + '.h'
+        source_path = os.path.join(bitmaps_dir, source)
+        output_path = os.path.join(bitmaps_dir, output)
+        if (force or not os.path.isfile(output_path)
+                or os.path.getmtime(output_path) < max(os.path.getmtime(source_path), script_time)):
+            print('fontcompiler: %s -> %s' % (source, output))
+            compile_font(source_path, name, output_path, symbol, encoding)
+
+
+try:
+    Import("env")       # only defined when PlatformIO runs this as pre script
+except NameError:
+    env = None
+
+if env is not None:
+    compile_fonts(env['PROJECT_DIR'])
+elif __name__ == '__main__':
+    compile_fonts(sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(os.path.abspath(__file__)), force=True)
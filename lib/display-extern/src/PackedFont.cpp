@@ -0,0 +1,99 @@
+/* row-major packed fonts for SPI_TFT_ILI9341
+ */
+
+#include "PackedFont.h"
+
+static inline void fill_row(unsigned short* p, unsigned int n, unsigned short colour)
+{
+    while (n--) *p++ = colour;
+}
+
+// expand the 8 pixels of one bitmap byte, MSB first
+static inline void expand_8(unsigned short* p, uint8_t bits, unsigned short fg, unsigned short bg)
+{
+    if (bits == 0x00) {
+        fill_row(p, 8, bg);
+    } else if (bits == 0xFF) {
+        fill_row(p, 8, fg);
+    } else {
+        p[0] = (bits & 0x80) ? fg : bg;
+        p[1] = (bits & 0x40) ? fg : bg;
+        p[2] = (bits & 0x20) ? fg : bg;
+        p[3] = (bits & 0x10) ? fg : bg;
+        p[4] = (bits & 0x08) ? fg : bg;
+        p[5] = (bits & 0x04) ? fg : bg;
+        p[6] = (bits & 0x02) ? fg : bg;
+        p[7] = (bits & 0x01) ? fg : bg;
+    }
+}
+
+// expand one row of a PACKED_FONT_BITS glyph
+static void expand_bits(const uint8_t* bits, unsigned int n, unsigned short* p, unsigned short fg, unsigned short bg)
+{
+    uint32_t word;
+
+    // 32 pixels per step, the bitmap has no alignment so the word is assembled bytewise
+    while (n >= 32) {
+        word = ((uint32_t)bits[0] << 24) | ((uint32_t)bits[1] << 16) | ((uint32_t)bits[2] << 8) | bits[3];
+        if (word == 0x00000000) {
+            fill_row(p, 32, bg);
+        } else if (word == 0xFFFFFFFF) {
+            fill_row(p, 32, fg);
+        } else {
+            expand_8(p, bits[0], fg, bg);
+            expand_8(p + 8, bits[1], fg, bg);
+            expand_8(p + 16, bits[2], fg, bg);
+            expand_8(p + 24, bits[3], fg, bg);
+        }
+        bits += 4;
+        p += 32;
+        n -= 32;
+    }
+    // 8 pixels per step
+    while (n >= 8) {
+        expand_8(p, *bits++, fg, bg);
+        p += 8;
+        n -= 8;
+    }
+    // last partial byte
+    if (n > 0) {
+        uint8_t b = *bits;
+        for (unsigned int i = 0; i < n; i++) {
+            *p++ = (b & 0x80) ? fg : bg;
+            b <<= 1;
+        }
+    }
+}
+
+// expand one row of a PACKED_FONT_RUNS glyph
+static void expand_runs(const uint8_t* runs, unsigned short* p, unsigned short fg, unsigned short bg)
+{
+    unsigned int n = *runs++;
+
+    for (unsigned int i = 0; i < n; i++) {
+        fill_row(p, runs[i], (i & 1) ? fg : bg);
+        p += runs[i];
+    }
+}
+
+void packed_font_row(const packed_font_t* font, const packed_glyph_t* glyph, int row,
+                     unsigned short* line, unsigned short fg, unsigned short bg)
+{
+    const uint8_t* data = &font->bitmap[glyph->offset];
+
+    row -= glyph->y;
+    if (row < 0 || row >= glyph->h) {   // row outside of the bounding box
+        fill_row(line, font->hor, bg);
+        return;
+    }
+
+    fill_row(line, glyph->x, bg);
+    if (font->encoding == PACKED_FONT_RUNS) {
+        data += data[2 * row] | (data[2 * row + 1] << 8);   // rows differ in length, look them up
+        expand_runs(data, line + glyph->x, fg, bg);
+    } else {
+        data += row * ((glyph->w + 7) >> 3);
+        expand_bits(data, glyph->w, line + glyph->x, fg, bg);
+    }
+    fill_row(line + glyph->x + glyph->w, font->hor - glyph->x - glyph->w, bg);
+}
@@ -0,0 +1,84 @@
+/* row-major packed fonts for SPI_TFT_ILI9341
+ *
+ * The GLCD Font Creator tables store every glyph column by column, which fights the
+ * row by row order of the ILI9341 pixel window. fontcompiler.py converts them at build
+ * time into this format: every glyph keeps only its trimmed bounding box, stored row
+ * by row in one of two encodings:
+ *
+ * PACKED_FONT_BITS: leftmost pixel in the MSB, every row padded to whole bytes
+ * PACKED_FONT_RUNS: number of runs, then the run lengths alternating background and
+ *                   foreground, starting with background - suits big glyphs made of
+ *                   long horizontal strokes. The rows are preceded by a table of h
+ *                   16 bit little endian row offsets from the start of the glyph
+ */
+
+#ifndef MBED_PACKED_FONT_H
+#define MBED_PACKED_FONT_H
+
+#include <stdint.h>
+
+#define PACKED_FONT_BITS 0
+#define PACKED_FONT_RUNS 1
+
+/** one glyph of a packed font
+ *
+ */
+typedef struct {
+    uint16_t offset;        // start of the glyph rows in the font bitmap
+    uint8_t advance;        // x offset to the next char
+    uint8_t x;              // bounding box of the set pixels inside the char cell
+    uint8_t y;
+    uint8_t w;
+    uint8_t h;
+} packed_glyph_t;
+
+/** packed font, one glyph for every char from first to last
+ *
+ */
+typedef struct {
+    uint8_t first;          // first char in font
+    uint8_t last;           // last char in font
+    uint8_t hor;            // horizontal size of the char cell
+    uint8_t vert;           // vertical size of the char cell
+    uint8_t encoding;       // PACKED_FONT_BITS or PACKED_FONT_RUNS
+    const packed_glyph_t* glyphs;
+    const uint8_t* bitmap;
+} packed_font_t;
+
+/** get the first row of a PACKED_FONT_RUNS glyph, after its row offset table
+ *
+ */
+static inline const uint8_t* packed_glyph_runs(const packed_font_t* font, const packed_glyph_t* glyph)
+{
+    return &font->bitmap[glyph->offset + 2 * glyph->h];
+}
+
+/** get the glyph of a char
+ *
+ * @param font packed font
+ * @param c char
+ * @returns glyph or NULL if the char is not part of the font
+ */
+static inline const packed_glyph_t* packed_font_glyph(const packed_font_t* font, int c)
+{
+    if (c < font->first || c > font->last) return 0;
+    return &font->glyphs[c - font->first];
+}
+
+/** expand one row of a char cell into 16 bit pixels
+ *
+ * writes font->hor pixels, empty bytes and words of the bitmap are filled
+ * 8 or 32 pixels at a time without testing single bits, runs are filled
+ * without any test
+ *
+ * @param font packed font
+ * @param glyph glyph out of this font
+ * @param row row inside the char cell (0 .. vert-1)
+ * @param line destination, at least font->hor pixels
+ * @param fg foreground colour
+ * @param bg background colour
+ */
+void packed_font_row(const packed_font_t* font, const packed_glyph_t* glyph, int row,
+                     unsigned short* line, unsigned short fg, unsigned short bg);
+
+#endif
@@ -18,6 +18,14 @@
 // 23.06.14 switch back to old Version - fork for L152 
 // 24.06.14 Add compiler flag for optimized L152 version
 // 25.06.14 Add optimized F103 version
+// 17.10.26 Bulk pixel writes through async SPI transfers
+// 17.10.26 Row-major packed fonts
+// 17.10.26 Run-length encoded packed fonts
+// 17.10.26 Cache the address window, drop WindowMax() after every primitive
+// 17.10.26 Span based circle rasteriser
+// 17.10.26 Drive SPI1 TX from DMA1 channel 3 on STM32L4, mbed's async SPI is interrupt driven there
+// 17.10.26 Static circle span cache, fillcircle() only paints the bounding box on request
+// 17.10.26 Release the display thread on a DMA transfer error too
 
 // exclude this file for platforms with optimized version
 #if defined TARGET_NUCLEO_L152RE || defined TARGET_NUCLEO_F103RB || defined TARGET_LPC1768
@@ -27,6 +35,14 @@
 #include "SPI_TFT_ILI9341.h"
 #include "mbed.h"
 
+#if defined TARGET_STM32L4
+#include "pinmap.h"
+#include "PeripheralPins.h"
+
+// the hal dma callbacks carry no context, there is one SPI1 TX channel anyway
+static SPI_TFT_ILI9341* dma_owner = NULL;
+#endif
+
 #define BPP         16                  // Bits per pixel    
          
 //extern Serial pc;
@@ -38,8 +54,19 @@ SPI_TFT_ILI9341::SPI_TFT_ILI9341(PinName mosi, PinName miso, PinName sclk, PinNa
     
     orientation = 0;
     char_x = 0;
+    font = NULL;
+    packed_font = NULL;
+    for (int i=0; i<TFT_CIRCLE_CACHE; i++) {
+        circle_radius[i] = -1;
+    }
+    circle_next = 0;
+    transfer_busy = false;
     SPI::format(8,3);                  // 8 bit spi mode 3
     SPI::frequency(10000000);          // 10 Mhz SPI clock
+    #if defined TARGET_STM32L4
+    dma_error_count = 0;
+    dma_init(mosi);
+    #endif
     tft_reset();
 }
 
@@ -99,6 +126,162 @@ void SPI_TFT_ILI9341::wr_dat(unsigned char dat)
 
 
 
+// bulk pixel transfer, the calling thread sleeps while the SPI transfer is running
+
+void SPI_TFT_ILI9341::fill_pixels(int colour, unsigned int count)
+{
+    #if defined TARGET_KL25Z  // 8 Bit SPI
+    for (unsigned int p=0; p<count; p++) {
+        SPI::write(colour >> 8);
+        SPI::write(colour & 0xff);
+    }
+    #else
+    unsigned int n = count < TFT_LINE_BUFFER_PIXELS ? count : TFT_LINE_BUFFER_PIXELS;
+    wait_pixels();
+    for (unsigned int p=0; p<n; p++) {
+        line_buffer[0][p] = colour;
+    }
+    SPI::format(16,3);                            // switch to 16 bit Mode 3
+    while (count > 0) {                           // the same buffer is sent for every chunk
+        n = count < TFT_LINE_BUFFER_PIXELS ? count : TFT_LINE_BUFFER_PIXELS;
+        start_pixels(line_buffer[0], n);
+        count -= n;
+    }
+    wait_pixels();
+    SPI::format(8,3);
+    #endif
+}
+
+
+
+void SPI_TFT_ILI9341::write_pixels(const unsigned short* data, unsigned int count)
+{
+    #ifndef TARGET_KL25Z  // 16 Bit SPI
+    SPI::format(16,3);                            // switch to 16 bit Mode 3
+    #endif
+    start_pixels(data, count);
+    wait_pixels();
+    #ifndef TARGET_KL25Z  // 16 Bit SPI
+    SPI::format(8,3);
+    #endif
+}
+
+
+
+void SPI_TFT_ILI9341::start_pixels(const unsigned short* data, unsigned int count)
+{
+    wait_pixels();
+    #if defined TARGET_KL25Z  // 8 Bit SPI
+    for (unsigned int p=0; p<count; p++) {
+        SPI::write(data[p] >> 8);
+        SPI::write(data[p] & 0xff);
+    }
+    #else
+    #if defined TARGET_STM32L4
+    if (spi_regs != NULL && count >= TFT_DMA_MIN_PIXELS) {   // short ones are faster blocking
+        transfer_busy = true;
+        SET_BIT(spi_regs->CR2, SPI_CR2_TXDMAEN);
+        HAL_DMA_Start_IT(&tx_dma, (uint32_t)data, (uint32_t)&spi_regs->DR, count);
+        return;
+    }
+    #endif
+    for (unsigned int p=0; p<count; p++) {
+        SPI::write(data[p]);
+    }
+    #endif
+}
+
+
+
+void SPI_TFT_ILI9341::wait_pixels(void)
+{
+    #if defined TARGET_STM32L4
+    if (transfer_busy) {
+        transfer_sem.acquire();
+        // the dma is done once the last word is in the tx fifo, the bus a few words later
+        while (spi_regs->SR & SPI_SR_FTLVL);
+        while (spi_regs->SR & SPI_SR_BSY);
+        CLEAR_BIT(spi_regs->CR2, SPI_CR2_TXDMAEN);
+        // nothing read the rx side meanwhile: drop it and clear the overrun for the blocking writes
+        while (spi_regs->SR & SPI_SR_FRLVL) {
+            (void)spi_regs->DR;
+        }
+        (void)spi_regs->SR;
+        transfer_busy = false;
+    }
+    #endif
+}
+
+
+
+#if defined TARGET_STM32L4
+// SPI1 TX is DMA1 channel 3 / request 1, other SPIs are written blocking
+
+void SPI_TFT_ILI9341::dma_init(PinName mosi)
+{
+    spi_regs = (SPI_TypeDef*)pinmap_peripheral(mosi, PinMap_SPI_MOSI);
+    if (spi_regs != SPI1 || dma_owner != NULL) {
+        spi_regs = NULL;
+        return;
+    }
+    dma_owner = this;
+
+    __HAL_RCC_DMA1_CLK_ENABLE();
+    tx_dma = DMA_HandleTypeDef();
+    tx_dma.Instance = DMA1_Channel3;
+    tx_dma.Init.Request = DMA_REQUEST_1;
+    tx_dma.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    tx_dma.Init.PeriphInc = DMA_PINC_DISABLE;
+    tx_dma.Init.MemInc = DMA_MINC_ENABLE;
+    tx_dma.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+    tx_dma.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+    tx_dma.Init.Mode = DMA_NORMAL;
+    tx_dma.Init.Priority = DMA_PRIORITY_LOW;
+    HAL_DMA_Init(&tx_dma);
+    tx_dma.XferCpltCallback = &SPI_TFT_ILI9341::dma_done;
+    tx_dma.XferErrorCallback = &SPI_TFT_ILI9341::dma_error;
+
+    NVIC_SetVector(DMA1_Channel3_IRQn, (uint32_t)&SPI_TFT_ILI9341::dma_irq);
+    NVIC_EnableIRQ(DMA1_Channel3_IRQn);
+}
+
+
+
+void SPI_TFT_ILI9341::dma_irq(void)
+{
+    HAL_DMA_IRQHandler(&dma_owner->tx_dma);
+}
+
+
+
+void SPI_TFT_ILI9341::dma_done(DMA_HandleTypeDef* hdma)
+{
+    dma_owner->transfer_sem.release();
+}
+
+
+
+// the hal has disabled the channel already, wait_pixels() drains what made it into the fifo
+void SPI_TFT_ILI9341::dma_error(DMA_HandleTypeDef* hdma)
+{
+    dma_owner->dma_error_count++;
+    dma_owner->transfer_sem.release();
+}
+#endif
+
+
+
+unsigned int SPI_TFT_ILI9341::dma_errors(void)
+{
+    #if defined TARGET_STM32L4
+    return dma_error_count;
+    #else
+    return 0;
+    #endif
+}
+
+
+
 // the ILI9341 can read 
 
 char SPI_TFT_ILI9341::rd_byte(unsigned char cmd)
@@ -152,6 +335,7 @@ int  SPI_TFT_ILI9341::Read_ID(void){
 
 void SPI_TFT_ILI9341::tft_reset()
 {
+    win_x0 = win_x1 = win_y0 = win_y1 = -1;  // address window unknown
     _cs = 1;                           // cs high
     _dc = 1;                           // dc high 
     _reset = 0;                        // display reset
@@ -309,14 +493,7 @@ void SPI_TFT_ILI9341::tft_reset()
 
 void SPI_TFT_ILI9341::pixel(int x, int y, int color)
 {
-    wr_cmd(0x2A);
-    SPI::write(x >> 8);
-    SPI::write(x);
-    _cs = 1;
-    wr_cmd(0x2B);
-    SPI::write(y >> 8);
-    SPI::write(y);
-    _cs = 1;
+    window(x, y, 1, 1);          // only the changed address is sent
     wr_cmd(0x2C);  // send pixel
     #if defined TARGET_KL25Z  // 8 Bit SPI
     SPI::write(color >> 8);
@@ -330,21 +507,32 @@ void SPI_TFT_ILI9341::pixel(int x, int y, int color)
 }
 
 
+// the controller keeps the column and page address between RAMWR commands,
+// so CASET / PASET are only sent if they differ from the last window
+
 void SPI_TFT_ILI9341::window (unsigned int x, unsigned int y, unsigned int w, unsigned int h)
 {
-    wr_cmd(0x2A);
-    SPI::write(x >> 8);
-    SPI::write(x);
-    SPI::write((x+w-1) >> 8);
-    SPI::write(x+w-1);
-    
-    _cs = 1;
-    wr_cmd(0x2B);
-    SPI::write(y >> 8);
-    SPI::write(y);
-    SPI::write((y+h-1) >> 8);
-    SPI::write(y+h-1);
-    _cs = 1;
+    int x1 = x + w - 1;
+    int y1 = y + h - 1;
+
+    if ((int)x != win_x0 || x1 != win_x1) {
+        wr_cmd(0x2A);
+        SPI::write(x >> 8);
+        SPI::write(x);
+        SPI::write(x1 >> 8);
+        SPI::write(x1);
+        win_x0 = x;
+        win_x1 = x1;
+    }
+    if ((int)y != win_y0 || y1 != win_y1) {
+        wr_cmd(0x2B);                  // cs stays low between the commands
+        SPI::write(y >> 8);
+        SPI::write(y);
+        SPI::write(y1 >> 8);
+        SPI::write(y1);
+        win_y0 = y;
+        win_y1 = y1;
+    }
 }
 
 
@@ -362,38 +550,150 @@ void SPI_TFT_ILI9341::cls (void)
 }
 
 
-void SPI_TFT_ILI9341::circle(int x0, int y0, int r, int color)
+// the spans come from the Bresenham circle of Michael Ammann, the first point
+// it visits on a row is the outermost one, so the pixels are the same as before
+
+const unsigned short* SPI_TFT_ILI9341::circle_spans(int r)
 {
+    unsigned short* spans;
+    int x,y,err,e2,dy;
+    unsigned int i;
 
-    int x = -r, y = 0, err = 2-2*r, e2;
+    if (r < 0 || r > TFT_CIRCLE_MAX_RADIUS) return NULL;
+    for (i=0; i<TFT_CIRCLE_CACHE; i++) {
+        if (circle_radius[i] == r) return circle_span[i];
+    }
+    i = circle_next;                     // replace the oldest entry
+    circle_next = (circle_next + 1) % TFT_CIRCLE_CACHE;
+    spans = circle_span[i];
+    circle_radius[i] = r;
+
+    dy = 0;
+    x = -r;
+    y = 0;
+    err = 2-2*r;
     do {
-        pixel(x0-x, y0+y,color);
-        pixel(x0+x, y0+y,color);
-        pixel(x0+x, y0-y,color);
-        pixel(x0-x, y0-y,color);
+        if (y == dy) {
+            spans[dy++] = -x;
+        }
         e2 = err;
         if (e2 <= y) {
             err += ++y*2+1;
             if (-x == y && e2 <= x) e2 = 0;
         }
         if (e2 > x) err += ++x*2+1;
-    } while (x <= 0);
+    } while (x <= 0 && y <= r);
+    return spans;
+}
+
 
+void SPI_TFT_ILI9341::circle(int x0, int y0, int r, int color)
+{
+    const unsigned short* spans = circle_spans(r);
+    int dy,a,outer,inner;
+
+    if (spans == NULL) {                 // too big for the span cache, plot it point by point
+        int x = -r, y = 0, err = 2-2*r, e2;
+        if (r < 0) return;
+        do {
+            pixel(x0-x, y0+y,color);
+            pixel(x0+x, y0+y,color);
+            pixel(x0+x, y0-y,color);
+            pixel(x0-x, y0-y,color);
+            e2 = err;
+            if (e2 <= y) {
+                err += ++y*2+1;
+                if (-x == y && e2 <= x) e2 = 0;
+            }
+            if (e2 > x) err += ++x*2+1;
+        } while (x <= 0);
+        return;
+    }
+    // every row from its edge in to the edge of the next row out, both sides
+    for (dy = -r; dy <= r; dy++) {
+        a = dy < 0 ? -dy : dy;
+        outer = spans[a];
+        inner = a < r ? spans[a + 1] + 1 : 0;
+        if (inner > outer) inner = outer;
+        if (inner == 0) {
+            hline(x0 - outer, x0 + outer, y0 + dy, color);
+        } else {
+            hline(x0 - outer, x0 - inner, y0 + dy, color);
+            hline(x0 + inner, x0 + outer, y0 + dy, color);
+        }
+    }
 }
 
+
 void SPI_TFT_ILI9341::fillcircle(int x0, int y0, int r, int color)
 {
-    int x = -r, y = 0, err = 2-2*r, e2;
-    do {
-        vline(x0-x, y0-y, y0+y, color);
-        vline(x0+x, y0-y, y0+y, color);
-        e2 = err;
-        if (e2 <= y) {
-            err += ++y*2+1;
-            if (-x == y && e2 <= x) e2 = 0;
+    const unsigned short* spans = circle_spans(r);
+    int dy;
+
+    if (spans == NULL) {                 // too big for the span cache, fill it column by column
+        int x = -r, y = 0, err = 2-2*r, e2;
+        if (r < 0) return;
+        do {
+            vline(x0-x, y0-y, y0+y, color);
+            vline(x0+x, y0-y, y0+y, color);
+            e2 = err;
+            if (e2 <= y) {
+                err += ++y*2+1;
+                if (-x == y && e2 <= x) e2 = 0;
+            }
+            if (e2 > x) err += ++x*2+1;
+        } while (x <= 0);
+        return;
+    }
+    for (dy = -r; dy <= r; dy++) {
+        int hw = spans[dy < 0 ? -dy : dy];
+        hline(x0 - hw, x0 + hw, y0 + dy, color);
+    }
+}
+
+
+void SPI_TFT_ILI9341::fillcircle(int x0, int y0, int r, int color, int background)
+{
+    const unsigned short* spans = circle_spans(r);
+    unsigned int w,n,buf,i;
+    unsigned short* p;
+    int dy,hw;
+
+    if (spans == NULL) {
+        if (r < 0) return;
+        fillrect(x0 - r, y0 - r, x0 + r, y0 + r, background);
+        fillcircle(x0, y0, r, color);
+        return;
+    }
+
+    w = 2 * r + 1;
+    window(x0 - r, y0 - r, w, w);       // bounding box
+    wr_cmd(0x2C);  // send pixel
+    #ifndef TARGET_KL25Z  // 16 Bit SPI
+    SPI::format(16,3);
+    #endif                         // switch to 16 bit Mode 3
+    // rows are collected in one line buffer while the other one is transferred
+    buf = 0;
+    n = 0;
+    p = line_buffer[buf];
+    for (dy = -r; dy <= r; dy++) {
+        hw = spans[dy < 0 ? -dy : dy];
+        for (i = hw; i < (unsigned int)r; i++) *p++ = background;
+        for (i = 0; i < (unsigned int)(2 * hw + 1); i++) *p++ = color;
+        for (i = hw; i < (unsigned int)r; i++) *p++ = background;
+        n += w;
+        if (n + w > TFT_LINE_BUFFER_PIXELS || dy == r) {
+            start_pixels(line_buffer[buf], n);
+            buf ^= 1;
+            p = line_buffer[buf];
+            n = 0;
         }
-        if (e2 > x) err += ++x*2+1;
-    } while (x <= 0);
+    }
+    wait_pixels();
+    _cs = 1;
+    #ifndef TARGET_KL25Z  // 16 Bit SPI
+    SPI::format(8,3);
+    #endif
 }
 
 
@@ -403,22 +703,8 @@ void SPI_TFT_ILI9341::hline(int x0, int x1, int y, int color)
     w = x1 - x0 + 1;
     window(x0,y,w,1);
     wr_cmd(0x2C);  // send pixel
-    #if defined TARGET_KL25Z  // 8 Bit SPI
-    int j;
-    for (j=0; j<w; j++) {
-        SPI::write(color >> 8);
-        SPI::write(color & 0xff);
-    } 
-    #else 
-    SPI::format(16,3);                            // switch to 16 bit Mode 3
-    int j;
-    for (j=0; j<w; j++) {
-        SPI::write(color);
-    }
-    SPI::format(8,3);
-    #endif
+    fill_pixels(color, w);
     _cs = 1;
-    WindowMax();
     return;
 }
 
@@ -428,20 +714,8 @@ void SPI_TFT_ILI9341::vline(int x, int y0, int y1, int color)
     h = y1 - y0 + 1;
     window(x,y0,1,h);
     wr_cmd(0x2C);  // send pixel
-    #if defined TARGET_KL25Z  // 8 Bit SPI
-    for (int y=0; y<h; y++) {
-        SPI::write(color >> 8);
-        SPI::write(color & 0xff);
-    } 
-    #else 
-    SPI::format(16,3);                            // switch to 16 bit Mode 3
-    for (int y=0; y<h; y++) {
-        SPI::write(color);
-    }
-    SPI::format(8,3);
-    #endif
+    fill_pixels(color, h);
     _cs = 1;
-    WindowMax();
     return;
 }
 
@@ -454,6 +728,7 @@ void SPI_TFT_ILI9341::line(int x0, int y0, int x1, int y1, int color)
     int   dx_sym = 0, dy_sym = 0;
     int   dx_x2 = 0, dy_x2 = 0;
     int   di = 0;
+    int   run;
 
     dx = x1-x0;
     dy = y1-y0;
@@ -487,33 +762,41 @@ void SPI_TFT_ILI9341::line(int x0, int y0, int x1, int y1, int color)
     dx_x2 = dx*2;
     dy_x2 = dy*2;
 
+    // pixels on the same row / column are collected into one hline / vline
     if (dx >= dy) {
         di = dy_x2 - dx;
+        run = x0;
         while (x0 != x1) {
-
-            pixel(x0, y0, color);
             x0 += dx_sym;
             if (di<0) {
                 di += dy_x2;
             } else {
                 di += dy_x2 - dx_x2;
+                if (dx_sym > 0) hline(run, x0 - 1, y0, color);
+                else hline(x0 + 1, run, y0, color);
                 y0 += dy_sym;
+                run = x0;
             }
         }
-        pixel(x0, y0, color);
+        if (dx_sym > 0) hline(run, x0, y0, color);
+        else hline(x0, run, y0, color);
     } else {
         di = dx_x2 - dy;
+        run = y0;
         while (y0 != y1) {
-            pixel(x0, y0, color);
             y0 += dy_sym;
             if (di < 0) {
                 di += dx_x2;
             } else {
                 di += dx_x2 - dy_x2;
+                if (dy_sym > 0) vline(x0, run, y0 - 1, color);
+                else vline(x0, y0 + 1, run, color);
                 x0 += dx_sym;
+                run = y0;
             }
         }
-        pixel(x0, y0, color);
+        if (dy_sym > 0) vline(x0, run, y0, color);
+        else vline(x0, y0, run, color);
     }
     return;
 }
@@ -547,20 +830,8 @@ void SPI_TFT_ILI9341::fillrect(int x0, int y0, int x1, int y1, int color)
     int pixel = h * w;
     window(x0,y0,w,h);
     wr_cmd(0x2C);  // send pixel 
-    #if defined TARGET_KL25Z  // 8 Bit SPI
-    for (int p=0; p<pixel; p++) {
-        SPI::write(color >> 8);
-        SPI::write(color & 0xff);
-    }
-   #else
-    SPI::format(16,3);                            // switch to 16 bit Mode 3
-    for (int p=0; p<pixel; p++) {
-        SPI::write(color);
-    }
-    SPI::format(8,3);
-    #endif
+    fill_pixels(color, pixel);
     _cs = 1;
-    WindowMax();
     return;
 }
 
@@ -575,14 +846,14 @@ void SPI_TFT_ILI9341::locate(int x, int y)
 
 int SPI_TFT_ILI9341::columns()
 {
-    return width() / font[1];
+    return width() / font_hor();
 }
 
 
 
 int SPI_TFT_ILI9341::rows()
 {
-    return height() / font[2];
+    return height() / font_vert();
 }
 
 
@@ -591,8 +862,8 @@ int SPI_TFT_ILI9341::_putc(int value)
 {
     if (value == '\n') {    // new line
         char_x = 0;
-        char_y = char_y + font[2];
-        if (char_y >= height() - font[2]) {
+        char_y = char_y + font_vert();
+        if (char_y >= height() - font_vert()) {
             char_y = 0;
         }
     } else {
@@ -604,10 +875,16 @@ int SPI_TFT_ILI9341::_putc(int value)
 
 void SPI_TFT_ILI9341::character(int x, int y, int c)
 {
-    unsigned int hor,vert,offset,bpl,j,i,b;
+    unsigned int hor,vert,offset,bpl,j,i,b,n,buf;
     unsigned char* zeichen;
+    unsigned short* p;
     unsigned char z,w;
 
+    if (packed_font != NULL) {           // packed fonts have their own renderer
+        packed_character(c);
+        return;
+    }
+
     if ((c < 31) || (c > 127)) return;   // test char range
 
     // read font parameter from start of array
@@ -630,41 +907,202 @@ void SPI_TFT_ILI9341::character(int x, int y, int c)
     #endif                         // switch to 16 bit Mode 3
     zeichen = &font[((c -32) * offset) + 4]; // start of char bitmap
     w = zeichen[0];                          // width of actual char
+    // lines are collected in one line buffer while the other one is transferred
+    buf = 0;
+    n = 0;
+    p = line_buffer[buf];
      for (j=0; j<vert; j++) {  //  vert line
         for (i=0; i<hor; i++) {   //  horz line
             z =  zeichen[bpl * i + ((j & 0xF8) >> 3)+1];
             b = 1 << (j & 0x07);
-            if (( z & b ) == 0x00) {
-               #ifndef TARGET_KL25Z  // 16 Bit SPI 
-                SPI::write(_background);
-               #else
-                SPI::write(_background >> 8);
-                SPI::write(_background & 0xff);
-                #endif
-            } else {
-                #ifndef TARGET_KL25Z  // 16 Bit SPI
-                SPI::write(_foreground);
-                #else
-                SPI::write(_foreground >> 8);
-                SPI::write(_foreground & 0xff);
-                #endif
-            }
+            *p++ = (( z & b ) == 0x00) ? _background : _foreground;
+        }
+        n += hor;
+        if (n + hor > TFT_LINE_BUFFER_PIXELS || j == vert - 1) {
+            start_pixels(line_buffer[buf], n);
+            buf ^= 1;
+            p = line_buffer[buf];
+            n = 0;
         }
     }
+    wait_pixels();
     _cs = 1;
     #ifndef TARGET_KL25Z  // 16 Bit SPI
     SPI::format(8,3);
     #endif
-    WindowMax();
     if ((w + 2) < hor) {                   // x offset to next char
         char_x += w + 2;
     } else char_x += hor;
 }
 
 
+void SPI_TFT_ILI9341::packed_character(int c)
+{
+    const packed_glyph_t* glyph;
+    unsigned int hor,vert,j,n,buf;
+    unsigned short* p;
+
+    glyph = packed_font_glyph(packed_font, c);
+    if (glyph == NULL) return;               // test char range
+
+    hor = packed_font->hor;
+    vert = packed_font->vert;
+
+    if (char_x + hor > width()) {
+        char_x = 0;
+        char_y = char_y + vert;
+        if (char_y >= height() - vert) {
+            char_y = 0;
+        }
+    }
+    window(char_x, char_y,hor,vert); // char box
+    wr_cmd(0x2C);  // send pixel
+    #ifndef TARGET_KL25Z  // 16 Bit SPI
+    SPI::format(16,3);
+    #endif                         // switch to 16 bit Mode 3
+    if (packed_font->encoding == PACKED_FONT_RUNS) {
+        run_glyph(glyph);
+    } else {
+        // rows are expanded into one line buffer while the other one is transferred
+        buf = 0;
+        n = 0;
+        p = line_buffer[buf];
+        for (j=0; j<vert; j++) {
+            packed_font_row(packed_font, glyph, j, p, _foreground, _background);
+            p += hor;
+            n += hor;
+            if (n + hor > TFT_LINE_BUFFER_PIXELS || j == vert - 1) {
+                start_pixels(line_buffer[buf], n);
+                buf ^= 1;
+                p = line_buffer[buf];
+                n = 0;
+            }
+        }
+    }
+    wait_pixels();
+    _cs = 1;
+    #ifndef TARGET_KL25Z  // 16 Bit SPI
+    SPI::format(8,3);
+    #endif
+    char_x += glyph->advance;              // x offset to next char
+}
+
+
+void SPI_TFT_ILI9341::run_glyph(const packed_glyph_t* glyph)
+{
+    const uint8_t* runs = packed_glyph_runs(packed_font, glyph);   // rows in order, no offsets needed
+    unsigned int hor,vert,j,i,n,total,count,len;
+    unsigned short colour,c;
+    unsigned short* p;
+
+    hor = packed_font->hor;
+    vert = packed_font->vert;
+    run_buf = 0;
+    run_fill = 0;
+    total = 0;
+    // background above the box and left of its first row
+    colour = _background;
+    count = glyph->y * hor + glyph->x;
+    for (j=0; j<glyph->h; j++) {
+        n = *runs++;
+        for (i=0; i<n; i++) {
+            c = (i & 1) ? _foreground : _background;
+            len = *runs++;
+            if (c == colour) {
+                count += len;
+                continue;
+            }
+            // colour changes, the finished run goes out
+            total += count;
+            if (count < hor && run_fill + count <= TFT_LINE_BUFFER_PIXELS) {
+                p = &line_buffer[run_buf][run_fill];
+                run_fill += count;
+                while (count--) *p++ = colour;
+            } else {
+                queue_run(colour, count);
+            }
+            colour = c;
+            count = len;
+        }
+        // background right of this row and left of the next one
+        if (colour != _background) {
+            queue_run(colour, count);
+            total += count;
+            colour = _background;
+            count = 0;
+        }
+        count += hor - glyph->w;
+    }
+    // the rest of the cell is background
+    queue_run(colour, hor * vert - total);
+    if (run_fill > 0) {
+        start_pixels(line_buffer[run_buf], run_fill);
+    }
+}
+
+
+void SPI_TFT_ILI9341::queue_run(int colour, unsigned int count)
+{
+    unsigned int n,p;
+
+    if (count >= packed_font->hor) {
+        // a whole row or more, send the collected pixels and repeat one buffer
+        if (run_fill > 0) {
+            start_pixels(line_buffer[run_buf], run_fill);
+            run_buf ^= 1;
+            run_fill = 0;
+        }
+        n = count < TFT_LINE_BUFFER_PIXELS ? count : TFT_LINE_BUFFER_PIXELS;
+        for (p=0; p<n; p++) {
+            line_buffer[run_buf][p] = colour;
+        }
+        while (count > 0) {
+            n = count < TFT_LINE_BUFFER_PIXELS ? count : TFT_LINE_BUFFER_PIXELS;
+            start_pixels(line_buffer[run_buf], n);
+            count -= n;
+        }
+        run_buf ^= 1;
+        return;
+    }
+    while (count > 0) {
+        n = TFT_LINE_BUFFER_PIXELS - run_fill;
+        if (count < n) n = count;
+        for (p=0; p<n; p++) {
+            line_buffer[run_buf][run_fill + p] = colour;
+        }
+        run_fill += n;
+        count -= n;
+        if (run_fill == TFT_LINE_BUFFER_PIXELS) {
+            start_pixels(line_buffer[run_buf], run_fill);
+            run_buf ^= 1;
+            run_fill = 0;
+        }
+    }
+}
+
+
+int SPI_TFT_ILI9341::font_hor(void)
+{
+    return packed_font != NULL ? packed_font->hor : font[1];
+}
+
+
+int SPI_TFT_ILI9341::font_vert(void)
+{
+    return packed_font != NULL ? packed_font->vert : font[2];
+}
+
+
 void SPI_TFT_ILI9341::set_font(unsigned char* f)
 {
     font = f;
+    packed_font = NULL;
+}
+
+
+void SPI_TFT_ILI9341::set_font(const packed_font_t* f)
+{
+    packed_font = f;
 }
 
 
@@ -674,11 +1112,6 @@ void SPI_TFT_ILI9341::Bitmap(unsigned int x, unsigned int y, unsigned int w, uns
     unsigned int  j;
     int padd;
     unsigned short *bitmap_ptr = (unsigned short *)bitmap;
-    #if defined TARGET_KL25Z  // 8 Bit SPI
-        unsigned short pix_temp;
-    #endif
-    
-    unsigned int i;
     
     // the lines are padded to multiple of 4 bytes in a bitmap
     padd = -1;
@@ -692,25 +1125,41 @@ void SPI_TFT_ILI9341::Bitmap(unsigned int x, unsigned int y, unsigned int w, uns
     SPI::format(16,3);
     #endif                            // switch to 16 bit Mode 3
     for (j = 0; j < h; j++) {         //Lines
-        for (i = 0; i < w; i++) {     // one line
-            #if defined TARGET_KL25Z  // 8 Bit SPI
-                pix_temp = *bitmap_ptr;
-                SPI::write(pix_temp >> 8);
-                SPI::write(pix_temp);
-                bitmap_ptr++;
-            #else
-                SPI::write(*bitmap_ptr);    // one line
-                bitmap_ptr++;
-            #endif
-        }
-        bitmap_ptr -= 2*w;
+        start_pixels(bitmap_ptr, w);  // one line, straight from flash
+        bitmap_ptr -= w;
         bitmap_ptr -= padd;
     }
+    wait_pixels();
     _cs = 1;
     #ifndef TARGET_KL25Z  // 16 Bit SPI 
     SPI::format(8,3);
     #endif
-    WindowMax();
+}
+
+
+void SPI_TFT_ILI9341::begin_stream(int x, int y, int w, int h)
+{
+    window(x, y, w, h);
+    wr_cmd(0x2C);  // send pixel
+    #ifndef TARGET_KL25Z  // 16 Bit SPI
+    SPI::format(16,3);                            // switch to 16 bit Mode 3
+    #endif
+}
+
+
+void SPI_TFT_ILI9341::stream_pixels(const unsigned short* data, unsigned int count)
+{
+    start_pixels(data, count);
+}
+
+
+void SPI_TFT_ILI9341::end_stream(void)
+{
+    wait_pixels();
+    _cs = 1;
+    #ifndef TARGET_KL25Z  // 16 Bit SPI
+    SPI::format(8,3);
+    #endif
 }
 
 
@@ -732,6 +1181,7 @@ int SPI_TFT_ILI9341::BMP_16(unsigned int x, unsigned int y, const char *Name_BMP
     unsigned int    i,off;
     int padd,j;
     unsigned short *line;
+    unsigned short *lines;
 
     // get the filename
     i=0;
@@ -767,8 +1217,8 @@ int SPI_TFT_ILI9341::BMP_16(unsigned int x, unsigned int y, const char *Name_BMP
 
     start_data = BMP_Header[OffsetPixData] + (BMP_Header[OffsetPixData + 1] << 8) + (BMP_Header[OffsetPixData + 2] << 16) + (BMP_Header[OffsetPixData + 3] << 24);
 
-    line = (unsigned short *) malloc (2 * PixelWidth); // we need a buffer for a line
-    if (line == NULL) {
+    lines = (unsigned short *) malloc (4 * PixelWidth); // we need a buffer for two lines
+    if (lines == NULL) {
         return(-4);         // error no memory
     }
 
@@ -785,22 +1235,16 @@ int SPI_TFT_ILI9341::BMP_16(unsigned int x, unsigned int y, const char *Name_BMP
     #endif                          // switch to 16 bit Mode 3
     for (j = PixelHeigh - 1; j >= 0; j--) {               //Lines bottom up
         off = j * (PixelWidth  * 2 + padd) + start_data;   // start of line
+        line = lines + (j & 1) * PixelWidth;    // read next line while the last one is sent
         fseek(Image, off ,SEEK_SET);
         fread(line,1,PixelWidth * 2,Image);       // read a line - slow 
-        for (i = 0; i < PixelWidth; i++) {        // copy pixel data to TFT
-        #ifndef TARGET_KL25Z // only 8 Bit SPI
-            SPI::write(line[i]);                  // one 16 bit pixel
-        #else  
-            SPI::write(line[i] >> 8);
-            SPI::write(line[i]);
-        #endif    
-        } 
+        start_pixels(line, PixelWidth);           // copy pixel data to TFT
      }
+    wait_pixels();
     _cs = 1;
     SPI::format(8,3);
-    free (line);
+    free (lines);
     fclose(Image);
-    WindowMax();
     return(1);
 }
 
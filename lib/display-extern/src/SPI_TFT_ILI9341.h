@@ -18,9 +18,19 @@
 
 #include "mbed.h"
 #include "GraphicsDisplay.h"
+#include "PackedFont.h"
 
 #define RGB(r,g,b)  (((r&0xF8)<<8)|((g&0xFC)<<3)|((b&0xF8)>>3)) //5 red | 6 green | 5 blue
 
+#define TFT_LINE_BUFFER_PIXELS 320      // size of one bulk transfer buffer (one display line)
+#define TFT_CIRCLE_CACHE 4              // number of radii circle_spans() keeps
+#define TFT_CIRCLE_MAX_RADIUS 120       // largest radius circle_spans() has room for
+#define TFT_DMA_MIN_PIXELS 16           // shorter transfers are written blocking, starting them costs more
+
+#if 2 * TFT_CIRCLE_MAX_RADIUS + 1 > TFT_LINE_BUFFER_PIXELS
+#error "a row of the largest cached circle has to fit the line buffer"
+#endif
+
 
 /* some RGB color definitions                                                 */
 #define Black           0x0000      /*   0,   0,   0 */
@@ -130,6 +140,25 @@
    * @param color 16 bit color                                                                 *
    */    
   void fillcircle(int x, int y, int r, int colour); 
+
+  /** draw a filled circle and paint the rest of its bounding box
+   *  the box is written in one window, which is faster than the
+   *  row by row fillcircle() but overwrites the corners
+   *
+   * @param x0,y0 center
+   * @param r radius
+   * @param color 16 bit color
+   * @param background 16 bit color of the pixels outside of the circle
+   */
+  void fillcircle(int x, int y, int r, int colour, int background);
+
+  /** get the horizontal spans of a circle, cached per radius
+   *
+   * @param r radius
+   * @returns r+1 half widths, entry dy belongs to the rows y0-dy and y0+dy
+   *          NULL if r is larger than TFT_CIRCLE_MAX_RADIUS
+   */
+  const unsigned short* circle_spans(int r);
  
     
   /** draw a 1 pixel line
@@ -244,6 +273,32 @@
    */      
     
   int BMP_16(unsigned int x, unsigned int y, const char *Name_BMP);  
+
+  /** open a draw window and start streaming pixels into it
+   *
+   * @param x,y : upper left corner
+   * @param w width of window
+   * @param h high of window
+   *
+   *   pixels are filled line by line with stream_pixels()
+   *   the stream has to be closed with end_stream()
+   */
+  void begin_stream(int x, int y, int w, int h);
+
+  /** queue pixels into the open stream
+   *
+   * @param data pointer to 16 bit R5 G6 B5 pixel data
+   * @param count number of pixels
+   *
+   *   returns while the transfer is running, data has to stay valid until
+   *   the next stream_pixels() or end_stream() call (use two buffers)
+   */
+  void stream_pixels(const unsigned short* data, unsigned int count);
+
+  /** wait for the last queued pixels and close the stream
+   *
+   */
+  void end_stream(void);
     
     
     
@@ -261,6 +316,16 @@
    *
    */  
   void set_font(unsigned char* f);
+
+  /** select a packed font to use
+   *
+   * @param f packed font generated by fontcompiler.py out of a GLCD font array
+   *
+   *   packed fonts are stored row by row and trimmed to the set pixels of every glyph,
+   *   they are expanded 8 or 32 pixels at a time instead of testing every pixel
+   *
+   */
+  void set_font(const packed_font_t* f);
    
   /** Set the orientation of the screen
    *  x,y: 0,0 is always top left 
@@ -276,11 +341,18 @@
    *  @returns ID
    */ 
   int Read_ID(void);
+
+  /** number of pixel transfers the DMA aborted with a transfer error
+   *  the pixels of such a transfer are lost, drawing goes on
+   *  @returns 0 on other targets than STM32L4
+   */
+  unsigned int dma_errors(void);
   
   DigitalOut _cs; 
   DigitalOut _reset;
   DigitalOut _dc;
   unsigned char* font;
+  const packed_font_t* packed_font;
   
   
   
@@ -342,6 +414,63 @@ protected:
    *
    */   
   void wr_cmd(unsigned char value);
+
+  /** Write pixels of one colour to the LCD controller (repeat colour mode)
+   *  a RAMWR (0x2C) sequence has to be started before
+   *
+   * @param colour 16 bit colour
+   * @param count number of pixels
+   */
+  void fill_pixels(int colour, unsigned int count);
+
+  /** Write pixels from memory to the LCD controller (memory to SPI mode)
+   *  a RAMWR (0x2C) sequence has to be started before
+   *
+   * @param data pointer to 16 bit R5 G6 B5 pixel data
+   * @param count number of pixels
+   */
+  void write_pixels(const unsigned short* data, unsigned int count);
+
+  /** Queue a bulk pixel transfer and return while it is running
+   *  waits for the previous transfer first, so the data has to stay valid
+   *  until the next start_pixels() or wait_pixels() call
+   *  SPI has to be in 16 bit mode
+   *
+   * @param data pointer to 16 bit R5 G6 B5 pixel data
+   * @param count number of pixels
+   */
+  void start_pixels(const unsigned short* data, unsigned int count);
+
+  /** Block the calling thread until the queued pixel transfer is done
+   *
+   */
+  void wait_pixels(void);
+
+  /** draw a character at the current position out of the packed font
+   *
+   * @param c char to print
+   */
+  void packed_character(int c);
+
+  /** stream the char cell of a PACKED_FONT_RUNS glyph
+   *  runs are coalesced across rows, runs of at least a whole cell row are sent
+   *  as repeated colour bursts, shorter ones are collected in the line buffers
+   *  a RAMWR (0x2C) sequence has to be started before, SPI in 16 bit mode
+   *
+   * @param glyph glyph out of the active packed font
+   */
+  void run_glyph(const packed_glyph_t* glyph);
+
+  /** queue count pixels of one colour for run_glyph()
+   *
+   */
+  void queue_run(int colour, unsigned int count);
+
+  /** horizontal / vertical size of the char cell of the active font
+   *
+   */
+  int font_hor(void);
+  int font_vert(void);
     
    /** Start data sequence to the LCD controller
    * 
@@ -398,6 +527,36 @@ protected:
   
   #endif  
     
+  #if defined TARGET_STM32L4
+  /** set up DMA1 channel 3 to feed the SPI1 tx fifo
+   *  mbed's SPI::transfer() is interrupt driven on STM32, it would take
+   *  an interrupt every few words
+   *
+   * @param mosi pin the SPI was opened with, other SPIs than SPI1 stay blocking
+   */
+  void dma_init(PinName mosi);
+
+  /** dma interrupt, transfer complete and transfer error callbacks (interrupt context)
+   *  both callbacks release transfer_sem, an error must not leave wait_pixels() blocked
+   */
+  static void dma_irq(void);
+  static void dma_done(DMA_HandleTypeDef* hdma);
+  static void dma_error(DMA_HandleTypeDef* hdma);
+
+  DMA_HandleTypeDef tx_dma;
+  SPI_TypeDef* spi_regs;               // NULL if there is no dma for this SPI
+  rtos::Semaphore transfer_sem;
+  volatile unsigned int dma_error_count;
+  #endif
+
+  unsigned short line_buffer[2][TFT_LINE_BUFFER_PIXELS];
+  volatile bool transfer_busy;
+  int win_x0, win_x1, win_y0, win_y1;  // address window last sent to the controller
+  int circle_radius[TFT_CIRCLE_CACHE];  // radii of the cached circle spans, -1 if unused
+  unsigned short circle_span[TFT_CIRCLE_CACHE][TFT_CIRCLE_MAX_RADIUS + 1];
+  unsigned int circle_next;             // cache entry replaced next
+  unsigned int run_buf;                 // line buffer run_glyph() collects into
+  unsigned int run_fill;                // pixels collected in it
   unsigned char spi_port; 
   unsigned int orientation;
   unsigned int char_x;
@@ -0,0 +1,206 @@
+// generated by fontcompiler.py from Arial12x12.h - do not edit
+#ifndef _ARIAL12X12_PACKED_H_
+#define _ARIAL12X12_PACKED_H_
+
+#include "PackedFont.h"
+
+const uint8_t Arial12x12_packed_bitmap[] = {
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x80,  // !
+        0xA0, 0xA0, 0xA0,  // "
+        0x14, 0x14, 0xFE, 0x28, 0x28, 0xFE, 0x28, 0x50, 0x50,  // #
+        0x70, 0xA8, 0xA0, 0xA0, 0x70, 0x28, 0xA8, 0xA8, 0x70, 0x20,  // $
+        0x62, 0x00, 0x94, 0x00, 0x94, 0x00, 0x98, 0x00, 0x6B, 0x00, 0x0C, 0x80, 0x14, 0x80, 0x14, 0x80, 0x23, 0x00,  // %
+        0x30, 0x48, 0x48, 0x50, 0x60, 0x94, 0x88, 0x8C, 0x72,  // &
+        0x80, 0x80, 0x80,  // '
+        0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20,  // (
+        0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80,  // )
+        0x20, 0xF8, 0x20, 0x50,  // *
+        0x20, 0x20, 0xF8, 0x20, 0x20,  // +
+        0x80, 0x80, 0x80,  // ,
+        0xE0,  // -
+        0x80,  // .
+        0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80,  // /
+        0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70,  // 0
+        0x20, 0x60, 0xA0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,  // 1
+        0x70, 0x88, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xF8,  // 2
+        0x70, 0x88, 0x08, 0x08, 0x30, 0x08, 0x08, 0x88, 0x70,  // 3
+        0x10, 0x30, 0x30, 0x50, 0x50, 0x90, 0xF8, 0x10, 0x10,  // 4
+        0x78, 0x40, 0x80, 0xF0, 0x88, 0x08, 0x08, 0x88, 0x70,  // 5
+        0x70, 0x88, 0x80, 0xB0, 0xC8, 0x88, 0x88, 0x88, 0x70,  // 6
+        0xF8, 0x10, 0x10, 0x20, 0x20, 0x20, 0x40, 0x40, 0x40,  // 7
+        0x70, 0x88, 0x88, 0x88, 0x70, 0x88, 0x88, 0x88, 0x70,  // 8
+        0x70, 0x88, 0x88, 0x88, 0x98, 0x68, 0x08, 0x88, 0x70,  // 9
+        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,  // :
+        0x80, 0x00, 0x80, 0x80, 0x80,  // ;
+        0x18, 0x60, 0x80, 0x60, 0x18,  // <
+        0xFC, 0x00, 0x00, 0xFC,  // =
+        0xC0, 0x30, 0x08, 0x30, 0xC0,  // >
+        0x70, 0x88, 0x88, 0x08, 0x10, 0x20, 0x20, 0x00, 0x20,  // ?
+        0x0F, 0x00, 0x30, 0xC0, 0x40, 0x40, 0x4D, 0x20, 0x93, 0x20, 0xA2, 0x20, 0xA2, 0x20, 0xA2, 0x40, 0x9F, 0x80, 0x40, 0x20, 0x20, 0xC0, 0x1F, 0x00,  // @
+        0x10, 0x28, 0x28, 0x28, 0x44, 0x7C, 0x44, 0x82, 0x82,  // A
+        0xF8, 0x84, 0x84, 0x84, 0xFC, 0x84, 0x84, 0x84, 0xF8,  // B
+        0x38, 0x44, 0x82, 0x80, 0x80, 0x80, 0x82, 0x44, 0x38,  // C
+        0xF8, 0x84, 0x82, 0x82, 0x82, 0x82, 0x82, 0x84, 0xF8,  // D
+        0xFC, 0x80, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x80, 0xFC,  // E
+        0xF8, 0x80, 0x80, 0x80, 0xF0, 0x80, 0x80, 0x80, 0x80,  // F
+        0x38, 0x44, 0x82, 0x80, 0x8E, 0x82, 0x82, 0x44, 0x38,  // G
+        0x82, 0x82, 0x82, 0x82, 0xFE, 0x82, 0x82, 0x82, 0x82,  // H
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,  // I
+        0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x88, 0x70,  // J
+        0x82, 0x84, 0x88, 0x90, 0xA0, 0xD0, 0x88, 0x84, 0x82,  // K
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC,  // L
+        0x82, 0xC6, 0xC6, 0xAA, 0xAA, 0xAA, 0xAA, 0x92, 0x92,  // M
+        0x82, 0xC2, 0xA2, 0xA2, 0x92, 0x8A, 0x8A, 0x86, 0x82,  // N
+        0x38, 0x44, 0x82, 0x82, 0x82, 0x82, 0x82, 0x44, 0x38,  // O
+        0xF8, 0x84, 0x84, 0x84, 0xF8, 0x80, 0x80, 0x80, 0x80,  // P
+        0x38, 0x44, 0x82, 0x82, 0x82, 0x82, 0x9A, 0x44, 0x3A,  // Q
+        0xFC, 0x82, 0x82, 0x82, 0xFC, 0x88, 0x84, 0x84, 0x82,  // R
+        0x78, 0x84, 0x84, 0x80, 0x78, 0x04, 0x84, 0x84, 0x78,  // S
+        0xFE, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,  // T
+        0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x44, 0x38,  // U
+        0x82, 0x82, 0x44, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10,  // V
+        0x84, 0x20, 0x8A, 0x20, 0x8A, 0x40, 0x4A, 0x40, 0x51, 0x40, 0x51, 0x40, 0x51, 0x40, 0x20, 0x80, 0x20, 0x80,  // W
+        0x82, 0x44, 0x44, 0x28, 0x10, 0x28, 0x44, 0x44, 0x82,  // X
+        0x82, 0x44, 0x44, 0x28, 0x10, 0x10, 0x10, 0x10, 0x10,  // Y
+        0x7E, 0x04, 0x08, 0x08, 0x10, 0x20, 0x20, 0x40, 0xFE,  // Z
+        0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0,  // [
+        0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20,  // backslash
+        0xC0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xC0,  // ]
+        0x20, 0x50, 0x50, 0x88, 0x88,  // ^
+        0xFE,  // _
+        0x80, 0x40,  // `
+        0x70, 0x88, 0x08, 0x78, 0x88, 0x98, 0x68,  // a
+        0x80, 0x80, 0xB0, 0xC8, 0x88, 0x88, 0x88, 0xC8, 0xB0,  // b
+        0x60, 0x90, 0x80, 0x80, 0x80, 0x90, 0x60,  // c
+        0x08, 0x08, 0x68, 0x98, 0x88, 0x88, 0x88, 0x88, 0x78,  // d
+        0x70, 0x88, 0x88, 0xF8, 0x80, 0x88, 0x70,  // e
+        0x30, 0x40, 0xE0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // f
+        0x68, 0x98, 0x88, 0x88, 0x88, 0x98, 0x68, 0x08, 0xF0,  // g
+        0x80, 0x80, 0xB0, 0xC8, 0x88, 0x88, 0x88, 0x88, 0x88,  // h
+        0x80, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,  // i
+        0x40, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80,  // j
+        0x80, 0x80, 0x88, 0x90, 0xA0, 0xE0, 0x90, 0x90, 0x88,  // k
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,  // l
+        0xB3, 0x00, 0xCC, 0x80, 0x88, 0x80, 0x88, 0x80, 0x88, 0x80, 0x88, 0x80, 0x88, 0x80,  // m
+        0xB0, 0xC8, 0x88, 0x88, 0x88, 0x88, 0x88,  // n
+        0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70,  // o
+        0xB0, 0xC8, 0x88, 0x88, 0x88, 0xC8, 0xB0, 0x80, 0x80,  // p
+        0x68, 0x98, 0x88, 0x88, 0x88, 0x98, 0x68, 0x08, 0x08,  // q
+        0xA0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80,  // r
+        0x70, 0x88, 0x80, 0x70, 0x08, 0x88, 0x70,  // s
+        0x40, 0x40, 0xE0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60,  // t
+        0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78,  // u
+        0x88, 0x88, 0x50, 0x50, 0x50, 0x20, 0x20,  // v
+        0x88, 0x80, 0x88, 0x80, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x22, 0x00, 0x22, 0x00,  // w
+        0x88, 0x50, 0x50, 0x20, 0x50, 0x50, 0x88,  // x
+        0x88, 0x88, 0x50, 0x50, 0x50, 0x20, 0x20, 0x20, 0x40,  // y
+        0xF8, 0x10, 0x10, 0x20, 0x40, 0x40, 0xF8,  // z
+        0x20, 0x40, 0x40, 0x40, 0x40, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20,  // {
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,  // |
+        0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x40, 0x40, 0x40, 0x40, 0x80,  // }
+        0x64, 0x98,  // ~
+        0xFE, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xFE,  // DEL
+};
+
+const packed_glyph_t Arial12x12_packed_glyphs[] = {
+        {     0,  9,  0,  0,  0,  0 },  // space
+        {     0,  4,  1,  0,  1,  9 },  // !
+        {     9,  5,  0,  0,  3,  3 },  // "
+        {    12,  9,  0,  0,  7,  9 },  // #
+        {    21,  8,  1,  0,  5, 10 },  // $
+        {    31, 12,  1,  0,  9,  9 },  // %
+        {    49, 10,  1,  0,  7,  9 },  // &
+        {    58,  4,  1,  0,  1,  3 },  // '
+        {    61,  6,  1,  0,  3, 11 },  // (
+        {    72,  5,  0,  0,  3, 11 },  // )
+        {    83,  7,  0,  0,  5,  4 },  // *
+        {    87,  8,  1,  2,  5,  5 },  // +
+        {    92,  4,  1,  8,  1,  3 },  // ,
+        {    95,  5,  0,  5,  3,  1 },  // -
+        {    96,  4,  1,  8,  1,  1 },  // .
+        {    97,  5,  0,  0,  3,  9 },  // /
+        {   106,  8,  1,  0,  5,  9 },  // 0
+        {   115,  8,  1,  0,  3,  9 },  // 1
+        {   124,  8,  1,  0,  5,  9 },  // 2
+        {   133,  8,  1,  0,  5,  9 },  // 3
+        {   142,  8,  1,  0,  5,  9 },  // 4
+        {   151,  8,  1,  0,  5,  9 },  // 5
+        {   160,  8,  1,  0,  5,  9 },  // 6
+        {   169,  8,  1,  0,  5,  9 },  // 7
+        {   178,  8,  1,  0,  5,  9 },  // 8
+        {   187,  8,  1,  0,  5,  9 },  // 9
+        {   196,  4,  1,  2,  1,  7 },  // :
+        {   203,  4,  1,  6,  1,  5 },  // ;
+        {   208,  8,  1,  2,  5,  5 },  // <
+        {   213,  8,  0,  3,  6,  4 },  // =
+        {   217,  8,  1,  2,  5,  5 },  // >
+        {   222,  8,  1,  0,  5,  9 },  // ?
+        {   231, 12,  1,  0, 11, 12 },  // @
+        {   255,  9,  0,  0,  7,  9 },  // A
+        {   264,  9,  1,  0,  6,  9 },  // B
+        {   273, 10,  1,  0,  7,  9 },  // C
+        {   282, 10,  1,  0,  7,  9 },  // D
+        {   291,  9,  1,  0,  6,  9 },  // E
+        {   300,  8,  1,  0,  5,  9 },  // F
+        {   309, 10,  1,  0,  7,  9 },  // G
+        {   318, 10,  1,  0,  7,  9 },  // H
+        {   327,  4,  1,  0,  1,  9 },  // I
+        {   336,  7,  0,  0,  5,  9 },  // J
+        {   345, 10,  1,  0,  7,  9 },  // K
+        {   354,  9,  1,  0,  6,  9 },  // L
+        {   363, 10,  1,  0,  7,  9 },  // M
+        {   372, 10,  1,  0,  7,  9 },  // N
+        {   381, 10,  1,  0,  7,  9 },  // O
+        {   390,  9,  1,  0,  6,  9 },  // P
+        {   399, 10,  1,  0,  7,  9 },  // Q
+        {   408, 10,  1,  0,  7,  9 },  // R
+        {   417,  9,  1,  0,  6,  9 },  // S
+        {   426,  9,  0,  0,  7,  9 },  // T
+        {   435, 10,  1,  0,  7,  9 },  // U
+        {   444,  9,  0,  0,  7,  9 },  // V
+        {   453, 12,  0,  0, 11,  9 },  // W
+        {   471,  9,  0,  0,  7,  9 },  // X
+        {   480,  9,  0,  0,  7,  9 },  // Y
+        {   489,  9,  0,  0,  7,  9 },  // Z
+        {   498,  5,  1,  0,  2, 11 },  // [
+        {   509,  5,  0,  0,  3,  9 },  // backslash
+        {   518,  4,  0,  0,  2, 11 },  // ]
+        {   529,  7,  0,  0,  5,  5 },  // ^
+        {   534,  9,  0, 10,  7,  1 },  // _
+        {   535,  5,  1,  0,  2,  2 },  // `
+        {   537,  8,  1,  2,  5,  7 },  // a
+        {   544,  8,  1,  0,  5,  9 },  // b
+        {   553,  7,  1,  2,  4,  7 },  // c
+        {   560,  8,  1,  0,  5,  9 },  // d
+        {   569,  8,  1,  2,  5,  7 },  // e
+        {   576,  6,  0,  0,  4,  9 },  // f
+        {   585,  8,  1,  2,  5,  9 },  // g
+        {   594,  8,  1,  0,  5,  9 },  // h
+        {   603,  4,  1,  0,  1,  9 },  // i
+        {   612,  4,  0,  0,  2, 11 },  // j
+        {   623,  8,  1,  0,  5,  9 },  // k
+        {   632,  4,  1,  0,  1,  9 },  // l
+        {   641, 12,  1,  2,  9,  7 },  // m
+        {   655,  8,  1,  2,  5,  7 },  // n
+        {   662,  8,  1,  2,  5,  7 },  // o
+        {   669,  8,  1,  2,  5,  9 },  // p
+        {   678,  8,  1,  2,  5,  9 },  // q
+        {   687,  6,  1,  2,  3,  7 },  // r
+        {   694,  8,  1,  2,  5,  7 },  // s
+        {   701,  5,  0,  0,  3,  9 },  // t
+        {   710,  8,  1,  2,  5,  7 },  // u
+        {   717,  7,  0,  2,  5,  7 },  // v
+        {   724, 11,  0,  2,  9,  7 },  // w
+        {   738,  7,  0,  2,  5,  7 },  // x
+        {   745,  7,  0,  2,  5,  9 },  // y
+        {   754,  7,  0,  2,  5,  7 },  // z
+        {   761,  5,  0,  0,  3, 11 },  // {
+        {   772,  4,  1,  0,  1, 11 },  // |
+        {   783,  6,  1,  0,  3, 11 },  // }
+        {   794,  9,  1,  4,  6,  2 },  // ~
+        {   796, 10,  1,  1,  7,  8 },  // DEL
+};
+
+const packed_font_t Arial12x12_packed = { 32, 127, 12, 12, PACKED_FONT_BITS, Arial12x12_packed_glyphs, Arial12x12_packed_bitmap };
+
+#endif
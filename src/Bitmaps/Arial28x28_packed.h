@@ -0,0 +1,205 @@
+// generated by fontcompiler.py from Arial28x28.h - do not edit
+#ifndef _ARIAL28X28_PACKED_H_
+#define _ARIAL28X28_PACKED_H_
+
+#include "PackedFont.h"
+
+const uint8_t Arial28x28_packed_bitmap[] = {
+        0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0,  // !
+        0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0x42,  // "
+        0x06, 0x0C, 0x06, 0x0C, 0x0E, 0x1C, 0x0C, 0x18, 0x0C, 0x18, 0x0C, 0x18, 0xFF, 0xFE, 0xFF, 0xFE, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0xFF, 0xFE, 0xFF, 0xFE, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0,  // #
+        0x03, 0x00, 0x0F, 0xC0, 0x3F, 0xF0, 0x73, 0x78, 0xE3, 0x38, 0xE3, 0x1C, 0xE3, 0x1C, 0xE3, 0x00, 0xF3, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xF8, 0x03, 0x38, 0x03, 0x1C, 0xE3, 0x1C, 0xE3, 0x1C, 0xF3, 0x1C, 0x73, 0x38, 0x7B, 0x78, 0x3F, 0xF0, 0x0F, 0xC0, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,  // $
+        0x3E, 0x00, 0xC0, 0x7F, 0x01, 0x80, 0x63, 0x01, 0x80, 0xC1, 0x83, 0x00, 0xC1, 0x83, 0x00, 0xC1, 0x86, 0x00, 0xC1, 0x8E, 0x00, 0xC1, 0x8C, 0x00, 0x63, 0x18, 0x00, 0x7F, 0x18, 0x00, 0x3C, 0x30, 0x00, 0x00, 0x31, 0xF0, 0x00, 0x63, 0xF8, 0x00, 0x63, 0x18, 0x00, 0xC6, 0x0C, 0x01, 0xC6, 0x0C, 0x01, 0x86, 0x0C, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x06, 0x03, 0x18, 0x06, 0x03, 0xF8, 0x0C, 0x01, 0xF0,  // %
+        0x07, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x1C, 0xF0, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x18, 0x60, 0x00, 0x1C, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x71, 0xC7, 0x00, 0x70, 0xE7, 0x00, 0xE0, 0x7E, 0x00, 0xE0, 0x3E, 0x00, 0xE0, 0x1E, 0x00, 0xE0, 0x1E, 0x00, 0x70, 0x3F, 0x00, 0x78, 0xF3, 0x80, 0x3F, 0xE1, 0xC0, 0x0F, 0x80, 0x80,  // &
+        0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x40,  // '
+        0x04, 0x0E, 0x1C, 0x18, 0x30, 0x30, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x30, 0x30, 0x18, 0x1C, 0x0E, 0x04,  // (
+        0x80, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0x80,  // )
+        0x0C, 0x00, 0x0C, 0x00, 0x4C, 0x80, 0xFF, 0xC0, 0x3F, 0x00, 0x1E, 0x00, 0x3F, 0x00, 0x73, 0x80, 0x21, 0x00,  // *
+        0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,  // +
+        0xE0, 0xE0, 0xE0, 0x20, 0x20, 0x40, 0xC0,  // ,
+        0xFF, 0xFF, 0xFF,  // -
+        0xE0, 0xE0, 0xE0,  // .
+        0x03, 0x03, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60, 0xC0, 0xC0,  // /
+        0x0F, 0x80, 0x1F, 0xC0, 0x3F, 0xE0, 0x78, 0xF0, 0x70, 0x70, 0x70, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xF0, 0x78, 0x70, 0x70, 0x78, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x0F, 0x80,  // 0
+        0x03, 0x07, 0x0F, 0x1F, 0x7F, 0xF7, 0xE7, 0x87, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,  // 1
+        0x0F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0x70, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0x7F, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8,  // 2
+        0x0F, 0x80, 0x3F, 0xC0, 0x7F, 0xE0, 0x70, 0xF0, 0xE0, 0x70, 0xE0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xF0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x38, 0xE0, 0x38, 0xF0, 0x38, 0x78, 0xF0, 0x7F, 0xF0, 0x3F, 0xE0, 0x0F, 0x80,  // 3
+        0x00, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xF0, 0x03, 0x70, 0x07, 0x70, 0x06, 0x70, 0x0C, 0x70, 0x1C, 0x70, 0x18, 0x70, 0x30, 0x70, 0x60, 0x70, 0xE0, 0x70, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70,  // 4
+        0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x67, 0x80, 0x7F, 0xE0, 0xFF, 0xF0, 0xF0, 0xF0, 0xE0, 0x78, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0xE0, 0x38, 0xF0, 0x78, 0x70, 0xF0, 0x7F, 0xE0, 0x3F, 0xE0, 0x0F, 0x80,  // 5
+        0x07, 0xC0, 0x1F, 0xE0, 0x3F, 0xF0, 0x78, 0x78, 0x70, 0x38, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE7, 0xC0, 0xEF, 0xE0, 0xFF, 0xF0, 0xF8, 0xF0, 0xF0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0x70, 0x78, 0x78, 0xF0, 0x3F, 0xF0, 0x1F, 0xE0, 0x0F, 0x80,  // 6
+        0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x70, 0x00, 0x60, 0x00, 0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00,  // 7
+        0x0F, 0x80, 0x1F, 0xC0, 0x3F, 0xE0, 0x78, 0xF0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x38, 0xE0, 0x3F, 0xE0, 0x0F, 0x80, 0x3F, 0xE0, 0x70, 0xF0, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xF8, 0x78, 0x7F, 0xF0, 0x3F, 0xE0, 0x0F, 0x80,  // 8
+        0x0F, 0x80, 0x3F, 0xC0, 0x7F, 0xE0, 0x78, 0xF0, 0xF0, 0x70, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xF0, 0x78, 0x78, 0xF8, 0x7F, 0xF8, 0x3F, 0xB8, 0x1F, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x70, 0xE0, 0x70, 0xF0, 0xF0, 0x7F, 0xE0, 0x3F, 0xC0, 0x1F, 0x00,  // 9
+        0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0,  // :
+        0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0x20, 0x20, 0x40, 0xC0,  // ;
+        0x00, 0x04, 0x00, 0x1C, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x00, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x04,  // <
+        0xFF, 0xFC, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0xFF, 0xFC,  // =
+        0x80, 0x00, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x7C, 0x03, 0xE0, 0x0F, 0x80, 0x7C, 0x00, 0xF0, 0x00, 0x80, 0x00,  // >
+        0x0F, 0x80, 0x3F, 0xE0, 0x78, 0xF0, 0x70, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,  // ?
+        0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xC0, 0x78, 0x00, 0x0F, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x18, 0x00, 0x07, 0x00, 0x30, 0x3C, 0xE3, 0x00, 0x30, 0xFF, 0xE3, 0x00, 0x61, 0xE3, 0xE1, 0x80, 0x61, 0xC1, 0xE1, 0x80, 0xC3, 0x81, 0xC1, 0x80, 0xC3, 0x81, 0xC1, 0x80, 0xC7, 0x01, 0xC1, 0x80, 0xC7, 0x01, 0xC1, 0x80, 0xC7, 0x01, 0xC3, 0x00, 0xC7, 0x03, 0xC3, 0x00, 0xC7, 0x03, 0x86, 0x00, 0xC7, 0x87, 0x86, 0x00, 0x63, 0x8F, 0x9C, 0x00, 0x61, 0xFB, 0xF8, 0x00, 0x70, 0xF1, 0xE0, 0x00, 0x38, 0x00, 0x00, 0xC0, 0x1C, 0x00, 0x01, 0x80, 0x0E, 0x00, 0x07, 0x00, 0x07, 0xC0, 0x1E, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00,  // @
+        0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xB0, 0x00, 0x03, 0xB8, 0x00, 0x03, 0xB8, 0x00, 0x03, 0x18, 0x00, 0x07, 0x1C, 0x00, 0x07, 0x1C, 0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x70, 0x01, 0xC0, 0x70, 0x01, 0xC0, 0xE0, 0x00, 0xE0, 0xE0, 0x00, 0xE0,  // A
+        0xFF, 0xE0, 0xFF, 0xF0, 0xFF, 0xF8, 0xE0, 0x3C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x38, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF8, 0xE0, 0x1C, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x1E, 0xFF, 0xFC, 0xFF, 0xF8, 0xFF, 0xE0,  // B
+        0x03, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x3E, 0x0F, 0x80, 0x78, 0x03, 0x80, 0x70, 0x03, 0xC0, 0x70, 0x01, 0x80, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x01, 0x80, 0x70, 0x01, 0xC0, 0x70, 0x03, 0x80, 0x78, 0x07, 0x80, 0x3E, 0x0F, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xF8, 0x00,  // C
+        0xFF, 0xF0, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0xE0, 0x1E, 0x00, 0xE0, 0x0F, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x0F, 0x00, 0xE0, 0x1E, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x00,  // D
+        0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE,  // E
+        0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,  // F
+        0x01, 0xFE, 0x00, 0x07, 0xFF, 0x80, 0x1F, 0xFF, 0xC0, 0x3E, 0x03, 0xE0, 0x3C, 0x00, 0xE0, 0x78, 0x00, 0xF0, 0x70, 0x00, 0x60, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x1F, 0xF0, 0xE0, 0x1F, 0xF0, 0xE0, 0x1F, 0xF0, 0xE0, 0x00, 0x70, 0x70, 0x00, 0x70, 0x78, 0x00, 0x70, 0x3C, 0x00, 0x70, 0x3F, 0x03, 0xF0, 0x1F, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x01, 0xFE, 0x00,  // G
+        0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,  // H
+        0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,  // I
+        0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0x1F, 0x00,  // J
+        0xE0, 0x07, 0x80, 0xE0, 0x0E, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0xE0, 0x00, 0xE1, 0xC0, 0x00, 0xE3, 0x80, 0x00, 0xE7, 0x00, 0x00, 0xEF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xF9, 0xC0, 0x00, 0xF1, 0xC0, 0x00, 0xE0, 0xE0, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x03, 0x80,  // K
+        0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8,  // L
+        0xF8, 0x03, 0xE0, 0xF8, 0x03, 0xE0, 0xF8, 0x03, 0xE0, 0xFC, 0x07, 0xE0, 0xFC, 0x07, 0xE0, 0xEC, 0x06, 0xE0, 0xEE, 0x06, 0xE0, 0xEE, 0x0E, 0xE0, 0xEE, 0x0E, 0xE0, 0xE6, 0x0C, 0xE0, 0xE7, 0x1C, 0xE0, 0xE7, 0x1C, 0xE0, 0xE7, 0x1C, 0xE0, 0xE3, 0x18, 0xE0, 0xE3, 0xB8, 0xE0, 0xE3, 0xB8, 0xE0, 0xE3, 0xB8, 0xE0, 0xE3, 0xB0, 0xE0, 0xE1, 0xF0, 0xE0, 0xE1, 0xF0, 0xE0, 0xE1, 0xF0, 0xE0,  // M
+        0xE0, 0x07, 0xF0, 0x07, 0xF8, 0x07, 0xF8, 0x07, 0xFC, 0x07, 0xFC, 0x07, 0xEE, 0x07, 0xE7, 0x07, 0xE7, 0x07, 0xE3, 0x87, 0xE1, 0x87, 0xE1, 0xC7, 0xE0, 0xE7, 0xE0, 0xE7, 0xE0, 0x77, 0xE0, 0x37, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x07,  // N
+        0x01, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x3E, 0x07, 0xC0, 0x38, 0x01, 0xC0, 0x70, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0x70, 0x00, 0xE0, 0x78, 0x00, 0xE0, 0x38, 0x01, 0xC0, 0x3E, 0x07, 0xC0, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x01, 0xF8, 0x00,  // O
+        0xFF, 0xF0, 0xFF, 0xF8, 0xFF, 0xFC, 0xE0, 0x1E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x3E, 0xFF, 0xFC, 0xFF, 0xF8, 0xFF, 0xE0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,  // P
+        0x01, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x3E, 0x07, 0xC0, 0x38, 0x01, 0xC0, 0x70, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0xE0, 0x00, 0x70, 0x70, 0x00, 0xE0, 0x70, 0x11, 0xE0, 0x38, 0x3D, 0xC0, 0x3E, 0x0F, 0xC0, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x01, 0xF8, 0xF0, 0x00, 0x00, 0x60,  // Q
+        0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0xE0, 0x0F, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x0F, 0x80, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0x3C, 0x00, 0xE0, 0x1E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0xC0, 0xE0, 0x01, 0xC0, 0xE0, 0x00, 0xE0,  // R
+        0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x78, 0x3C, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x00, 0x78, 0x00, 0x3F, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0xFE, 0x00, 0x1E, 0x00, 0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xF0, 0x07, 0x7C, 0x1E, 0x3F, 0xFE, 0x1F, 0xFC, 0x07, 0xF0,  // S
+        0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00,  // T
+        0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xF0, 0x07, 0x70, 0x0E, 0x78, 0x1E, 0x3F, 0xFC, 0x1F, 0xF8, 0x0F, 0xE0,  // U
+        0xE0, 0x00, 0xE0, 0x70, 0x01, 0xC0, 0x70, 0x01, 0xC0, 0x70, 0x01, 0xC0, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x1C, 0x07, 0x00, 0x1C, 0x07, 0x00, 0x1C, 0x07, 0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x07, 0x1C, 0x00, 0x07, 0x1C, 0x00, 0x07, 0x9C, 0x00, 0x03, 0xB8, 0x00, 0x03, 0xB8, 0x00, 0x03, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00,  // V
+        0xE0, 0x1F, 0x00, 0xE0, 0xE0, 0x1F, 0x00, 0xE0, 0xE0, 0x1F, 0x01, 0xC0, 0x60, 0x3B, 0x81, 0xC0, 0x70, 0x3B, 0x81, 0xC0, 0x70, 0x3B, 0x81, 0xC0, 0x70, 0x73, 0x83, 0x80, 0x70, 0x73, 0xC3, 0x80, 0x38, 0x71, 0xC3, 0x80, 0x38, 0x71, 0xC3, 0x80, 0x38, 0xE1, 0xC7, 0x00, 0x38, 0xE1, 0xC7, 0x00, 0x38, 0xE1, 0xE7, 0x00, 0x1C, 0xE0, 0xE7, 0x00, 0x1D, 0xC0, 0xEE, 0x00, 0x1D, 0xC0, 0xEE, 0x00, 0x1D, 0xC0, 0xEE, 0x00, 0x1D, 0xC0, 0xEE, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x0F, 0x80, 0x7C, 0x00,  // W
+        0x70, 0x01, 0xC0, 0x38, 0x03, 0x80, 0x1C, 0x07, 0x00, 0x1E, 0x0F, 0x00, 0x0E, 0x0E, 0x00, 0x07, 0x1C, 0x00, 0x03, 0xB8, 0x00, 0x03, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xB8, 0x00, 0x07, 0x1C, 0x00, 0x07, 0x1C, 0x00, 0x0E, 0x0E, 0x00, 0x1C, 0x07, 0x00, 0x3C, 0x07, 0x80, 0x38, 0x03, 0x80, 0x70, 0x01, 0xC0, 0xE0, 0x00, 0xE0,  // X
+        0xE0, 0x00, 0xE0, 0x70, 0x01, 0xC0, 0x78, 0x01, 0xC0, 0x38, 0x03, 0x80, 0x1C, 0x07, 0x00, 0x0E, 0x07, 0x00, 0x0E, 0x0E, 0x00, 0x07, 0x1C, 0x00, 0x03, 0x9C, 0x00, 0x03, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00,  // Y
+        0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0xFF, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // Z
+        0xFC, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFC, 0xFC, 0xFC,  // [
+        0xC0, 0xC0, 0x60, 0x60, 0x60, 0x30, 0x30, 0x30, 0x30, 0x18, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x06, 0x06, 0x06, 0x03, 0x03,  // backslash
+        0xFC, 0xFC, 0xFC, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFC, 0xFC,  // ]
+        0x02, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0D, 0x80, 0x0D, 0x80, 0x18, 0xC0, 0x38, 0x60, 0x30, 0x60, 0x60, 0x30, 0x60, 0x30, 0xC0, 0x18,  // ^
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  // _
+        0xF0, 0x70, 0x38, 0x18,  // `
+        0x0F, 0xE0, 0x3F, 0xF0, 0x70, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0x00, 0x38, 0x00, 0xF8, 0x1F, 0xF8, 0x7F, 0x38, 0xF0, 0x38, 0xE0, 0x38, 0xE0, 0x78, 0xF0, 0xF8, 0x7F, 0xB8, 0x3E, 0x1C,  // a
+        0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE7, 0x80, 0xFF, 0xE0, 0xF8, 0xF0, 0xF0, 0x70, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xF0, 0x70, 0xF8, 0xF0, 0xEF, 0xE0, 0xE7, 0x80,  // b
+        0x0F, 0x80, 0x3F, 0xC0, 0x78, 0xE0, 0x70, 0x70, 0xE0, 0x70, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x70, 0x70, 0x70, 0x78, 0xE0, 0x3F, 0xC0, 0x0F, 0x80,  // c
+        0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x0F, 0x38, 0x3F, 0xF8, 0x78, 0xF8, 0x70, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0x70, 0x78, 0x78, 0xF8, 0x3F, 0xB8, 0x0F, 0x38,  // d
+        0x0F, 0x80, 0x3F, 0xE0, 0x78, 0xF0, 0x70, 0x70, 0xE0, 0x38, 0xE0, 0x38, 0xFF, 0xF8, 0xFF, 0xF8, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x38, 0x70, 0x78, 0x78, 0xF0, 0x3F, 0xE0, 0x0F, 0xC0,  // e
+        0x0F, 0x80, 0x1F, 0x80, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,  // f
+        0x0F, 0x38, 0x3F, 0xB8, 0x78, 0xF8, 0x70, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0x70, 0x78, 0x78, 0xF8, 0x3F, 0xF8, 0x0F, 0x38, 0x00, 0x38, 0xE0, 0x38, 0xE0, 0x70, 0x70, 0xF0, 0x7F, 0xE0, 0x1F, 0x80,  // g
+        0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE7, 0xC0, 0xEF, 0xF0, 0xF8, 0x78, 0xF0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38,  // h
+        0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,  // i
+        0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0xE0, 0xC0,  // j
+        0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x38, 0xE0, 0xF0, 0xE1, 0xE0, 0xE3, 0xC0, 0xE7, 0x80, 0xEE, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xF3, 0x80, 0xE1, 0xC0, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0x70, 0xE0, 0x38, 0xE0, 0x1C,  // k
+        0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,  // l
+        0xE7, 0xC3, 0xE0, 0xEF, 0xE7, 0xF0, 0xF8, 0xFC, 0x78, 0xF0, 0x78, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38,  // m
+        0xE7, 0xC0, 0xEF, 0xF0, 0xF8, 0x78, 0xF0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38,  // n
+        0x0F, 0x80, 0x3F, 0xE0, 0x78, 0xF0, 0x70, 0x70, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0x70, 0x70, 0x78, 0xF0, 0x3F, 0xE0, 0x0F, 0x80,  // o
+        0xE7, 0x80, 0xEF, 0xE0, 0xF8, 0xF0, 0xF0, 0x70, 0xF0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xF0, 0x70, 0xF8, 0xF0, 0xFF, 0xE0, 0xE7, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,  // p
+        0x0F, 0x38, 0x3F, 0xB8, 0x78, 0xF8, 0x70, 0x78, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0x70, 0x78, 0x78, 0xF8, 0x3F, 0xF8, 0x0F, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,  // q
+        0xE7, 0x00, 0xEF, 0x80, 0xF9, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,  // r
+        0x1F, 0x00, 0x7F, 0xC0, 0xF1, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0x00, 0x7E, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x03, 0xF0, 0xE0, 0x70, 0xE0, 0x70, 0x70, 0xF0, 0x7F, 0xE0, 0x1F, 0x80,  // s
+        0x08, 0x38, 0x38, 0x38, 0x38, 0xFE, 0xFE, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3E, 0x1E,  // t
+        0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x78, 0x70, 0xF8, 0x7F, 0xB8, 0x1F, 0x38,  // u
+        0xE0, 0x0E, 0x70, 0x1C, 0x70, 0x1C, 0x70, 0x1C, 0x38, 0x38, 0x38, 0x38, 0x3C, 0x38, 0x1C, 0x70, 0x1C, 0x70, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0,  // v
+        0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x71, 0xB1, 0xC0, 0x71, 0xB1, 0xC0, 0x71, 0xB1, 0xC0, 0x71, 0xB1, 0xC0, 0x73, 0xBB, 0x80, 0x3B, 0x1B, 0x80, 0x3B, 0x1B, 0x80, 0x3B, 0x1B, 0x80, 0x3B, 0x1B, 0x80, 0x1E, 0x0F, 0x00, 0x1E, 0x0F, 0x00, 0x1E, 0x0F, 0x00,  // w
+        0xE0, 0x1C, 0x70, 0x38, 0x38, 0x70, 0x1C, 0xE0, 0x1C, 0xE0, 0x0F, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x0F, 0xC0, 0x1C, 0xE0, 0x1C, 0xE0, 0x38, 0x70, 0x70, 0x38, 0xE0, 0x1C,  // x
+        0xE0, 0x0E, 0xE0, 0x1C, 0x70, 0x1C, 0x70, 0x1C, 0x38, 0x38, 0x38, 0x38, 0x1C, 0x70, 0x1C, 0x70, 0x1E, 0x60, 0x0E, 0xE0, 0x0E, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x7C, 0x00, 0x78, 0x00,  // y
+        0x7F, 0xF8, 0x7F, 0xF8, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0xFF, 0xF8, 0xFF, 0xF8,  // z
+        0x06, 0x0C, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0x60, 0x20, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x0C, 0x06,  // {
+        0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,  // |
+        0x80, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x70, 0x30, 0x18, 0x18, 0x30, 0x20, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0x80,  // }
+        0x7E, 0x04, 0xFF, 0xFC, 0xFF, 0xFC, 0x81, 0xF8,  // ~
+};
+
+const packed_glyph_t Arial28x28_packed_glyphs[] = {
+        {     0, 17,  0,  0,  0,  0 },  // space
+        {     0,  7,  2,  1,  3, 21 },  // !
+        {    21, 11,  1,  1,  8,  7 },  // "
+        {    28, 17,  0,  1, 15, 21 },  // #
+        {    70, 17,  1,  0, 14, 25 },  // $
+        {   120, 26,  2,  1, 22, 22 },  // %
+        {   186, 21,  1,  1, 18, 21 },  // &
+        {   249,  6,  1,  1,  3,  7 },  // '
+        {   256, 22, 13,  1,  7, 26 },  // (
+        {   282,  7,  0,  2,  5, 24 },  // )
+        {   306, 12,  0,  1, 10,  9 },  // *
+        {   324, 17,  1,  5, 14, 14 },  // +
+        {   352,  7,  2, 19,  3,  7 },  // ,
+        {   359, 11,  1, 13,  8,  3 },  // -
+        {   362,  7,  2, 19,  3,  3 },  // .
+        {   365, 10,  0,  1,  8, 21 },  // /
+        {   386, 17,  1,  1, 13, 21 },  // 0
+        {   428, 17,  2,  1,  8, 21 },  // 1
+        {   449, 17,  1,  1, 13, 21 },  // 2
+        {   491, 17,  1,  1, 13, 21 },  // 3
+        {   533, 17,  0,  1, 15, 21 },  // 4
+        {   575, 17,  1,  1, 13, 21 },  // 5
+        {   617, 17,  1,  1, 13, 21 },  // 6
+        {   659, 17,  1,  1, 13, 21 },  // 7
+        {   701, 17,  1,  1, 13, 21 },  // 8
+        {   743, 17,  1,  1, 13, 21 },  // 9
+        {   785,  7,  2,  7,  3, 15 },  // :
+        {   800,  7,  2,  7,  3, 19 },  // ;
+        {   819, 17,  1,  4, 14, 15 },  // <
+        {   849, 17,  1,  7, 14,  9 },  // =
+        {   867, 17,  1,  4, 14, 14 },  // >
+        {   895, 16,  1,  1, 13, 21 },  // ?
+        {   937, 28,  2,  1, 26, 27 },  // @
+        {  1045, 21,  0,  1, 19, 21 },  // A
+        {  1108, 19,  2,  1, 15, 21 },  // B
+        {  1150, 21,  1,  1, 18, 21 },  // C
+        {  1213, 21,  2,  1, 17, 21 },  // D
+        {  1276, 19,  2,  1, 15, 21 },  // E
+        {  1318, 18,  2,  1, 14, 21 },  // F
+        {  1360, 23,  1,  1, 20, 21 },  // G
+        {  1423, 20,  2,  1, 16, 21 },  // H
+        {  1465,  7,  2,  1,  3, 21 },  // I
+        {  1486, 14,  1,  1, 11, 21 },  // J
+        {  1528, 21,  2,  1, 17, 21 },  // K
+        {  1591, 17,  2,  1, 13, 21 },  // L
+        {  1633, 23,  2,  1, 19, 21 },  // M
+        {  1696, 20,  2,  1, 16, 21 },  // N
+        {  1738, 23,  1,  1, 20, 21 },  // O
+        {  1801, 19,  2,  1, 15, 21 },  // P
+        {  1843, 23,  1,  1, 20, 22 },  // Q
+        {  1909, 23,  2,  1, 19, 21 },  // R
+        {  1972, 19,  1,  1, 16, 21 },  // S
+        {  2014, 19,  0,  1, 17, 21 },  // T
+        {  2077, 20,  2,  1, 16, 21 },  // U
+        {  2119, 21,  0,  1, 19, 21 },  // V
+        {  2182, 28,  0,  1, 27, 21 },  // W
+        {  2266, 21,  0,  1, 19, 21 },  // X
+        {  2329, 21,  0,  1, 19, 21 },  // Y
+        {  2392, 19,  1,  1, 16, 21 },  // Z
+        {  2434,  9,  1,  1,  6, 27 },  // [
+        {  2461, 10,  0,  1,  8, 21 },  // backslash
+        {  2482,  8,  0,  1,  6, 27 },  // ]
+        {  2509, 16,  1,  1, 13, 11 },  // ^
+        {  2531, 26,  0, 26, 24,  2 },  // _
+        {  2537,  8,  1,  1,  5,  4 },  // `
+        {  2541, 17,  1,  7, 14, 15 },  // a
+        {  2571, 16,  1,  1, 13, 21 },  // b
+        {  2613, 15,  1,  7, 12, 15 },  // c
+        {  2643, 16,  1,  1, 13, 21 },  // d
+        {  2685, 16,  1,  7, 13, 15 },  // e
+        {  2715, 11,  0,  1,  9, 21 },  // f
+        {  2757, 16,  1,  7, 13, 21 },  // g
+        {  2799, 16,  1,  1, 13, 21 },  // h
+        {  2841,  6,  1,  1,  3, 21 },  // i
+        {  2862,  6,  0,  1,  4, 27 },  // j
+        {  2889, 17,  1,  1, 14, 21 },  // k
+        {  2931,  6,  1,  1,  3, 21 },  // l
+        {  2952, 24,  1,  7, 21, 15 },  // m
+        {  2997, 16,  1,  7, 13, 15 },  // n
+        {  3027, 16,  1,  7, 13, 15 },  // o
+        {  3057, 16,  1,  7, 13, 21 },  // p
+        {  3099, 16,  1,  7, 13, 21 },  // q
+        {  3141, 12,  1,  7,  9, 15 },  // r
+        {  3171, 15,  1,  7, 12, 15 },  // s
+        {  3201,  9,  0,  2,  7, 20 },  // t
+        {  3221, 16,  1,  7, 13, 15 },  // u
+        {  3251, 17,  0,  7, 15, 15 },  // v
+        {  3281, 22,  1,  7, 19, 15 },  // w
+        {  3326, 16,  0,  7, 14, 15 },  // x
+        {  3356, 17,  0,  7, 15, 21 },  // y
+        {  3398, 16,  1,  7, 13, 15 },  // z
+        {  3428, 22, 13,  1,  7, 26 },  // {
+        {  3454,  7,  3,  1,  2, 27 },  // |
+        {  3481,  7,  0,  2,  5, 24 },  // }
+        {  3505, 17,  1, 10, 14,  4 },  // ~
+        {  3513,  3,  0,  0,  0,  0 },  // DEL
+};
+
+const packed_font_t Arial28x28_packed = { 32, 127, 28, 28, PACKED_FONT_BITS, Arial28x28_packed_glyphs, Arial28x28_packed_bitmap };
+
+#endif
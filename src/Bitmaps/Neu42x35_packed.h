@@ -0,0 +1,206 @@
+// generated by fontcompiler.py from font_big.h - do not edit
+#ifndef _NEU42X35_PACKED_H_
+#define _NEU42X35_PACKED_H_
+
+#include "PackedFont.h"
+
+const uint8_t Neu42x35_packed_bitmap[] = {
+        0x30, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x30, 0x00, 0x70, 0xF8, 0xF8, 0x70,  // !
+        0x39, 0xC0, 0x7B, 0xC0, 0x7B, 0xC0, 0x7B, 0xC0, 0xFB, 0xC0, 0xF7, 0x80, 0xF7, 0x80, 0xE7, 0x00,  // "
+        0x00, 0x18, 0x30, 0x00, 0x00, 0x3C, 0x78, 0x00, 0x00, 0x7C, 0x78, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00, 0xF8, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x07, 0x8F, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x0F, 0x1E, 0x00, 0x00, 0x1E, 0x3E, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0x0C, 0x18, 0x00, 0x00,  // #
+        0x00, 0x18, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0xF8, 0x3C, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x3C, 0x0F, 0x80, 0x00, 0x3C, 0x07, 0x80, 0x00, 0x3C, 0x07, 0x80, 0x00, 0x3C, 0x07, 0x80, 0x00, 0x3C, 0x0F, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,  // $
+        0x1F, 0xF8, 0x00, 0x78, 0x00, 0x7F, 0xFE, 0x00, 0xF8, 0x00, 0xFF, 0xFF, 0x01, 0xF0, 0x00, 0xFF, 0xFF, 0x07, 0xE0, 0x00, 0xF8, 0x1F, 0x0F, 0xC0, 0x00, 0xF0, 0x0F, 0x1F, 0x80, 0x00, 0xF8, 0x1F, 0x3F, 0x00, 0x00, 0xFF, 0xFF, 0x7E, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xFC, 0x00, 0x00, 0x1F, 0xBF, 0xFF, 0x00, 0x00, 0x3F, 0x7F, 0xFF, 0x80, 0x00, 0x7E, 0x7F, 0xFF, 0x80, 0x00, 0xFC, 0x7C, 0x07, 0x80, 0x01, 0xF8, 0x78, 0x07, 0x80, 0x03, 0xF0, 0x7C, 0x0F, 0x80, 0x07, 0xE0, 0x7F, 0xFF, 0x80, 0x0F, 0xC0, 0x7F, 0xFF, 0x00, 0x07, 0x80, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,  // %
+        0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x7C, 0x00, 0x1F, 0x01, 0xF8, 0x00, 0x07, 0xDF, 0xE0, 0x00, 0x07, 0xFF, 0x80, 0xC0, 0x3F, 0xFE, 0x01, 0xE0, 0x7F, 0x3F, 0x81, 0xE0, 0xFC, 0x0F, 0xC1, 0xE0, 0xF0, 0x03, 0xF1, 0xE0, 0xF0, 0x00, 0xFD, 0xE0, 0xF0, 0x00, 0x7F, 0xE0, 0xF8, 0x00, 0x1F, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFC, 0x70,  // &
+        0x38, 0x78, 0x78, 0x78, 0xF8, 0xF0, 0xF0, 0xE0,  // '
+        0x0E, 0x1F, 0x3E, 0x7C, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0E,  // (
+        0x70, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1F, 0x3E, 0x7C, 0xF8, 0x70,  // )
+        0x01, 0x80, 0x63, 0xC6, 0xF3, 0xCF, 0xFB, 0xDF, 0x7F, 0xFE, 0x3F, 0xFC, 0x3F, 0xFC, 0x7F, 0xFE, 0xFB, 0xDF, 0xF3, 0xCF, 0x63, 0xC6, 0x01, 0x80,  // *
+        0x03, 0x00, 0x07, 0x80, 0x07, 0x80, 0x7F, 0xF8, 0xFF, 0xFC, 0xFF, 0xFC, 0x7F, 0xF8, 0x07, 0x80, 0x07, 0x80, 0x03, 0x00,  // +
+        0x38, 0x78, 0x78, 0x78, 0xF0, 0xF0, 0xF0, 0xE0,  // ,
+        0x7F, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFC,  // -
+        0x70, 0xF8, 0xF8, 0x70,  // .
+        0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,  // /
+        0x07, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xFC, 0x00, 0x0F, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xFC, 0x00, 0x07, 0xC0, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF8, 0x00,  // 0
+        0x7C, 0xFE, 0xFE, 0x7E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x0C,  // 1
+        0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFE, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0,  // 2
+        0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFE, 0x00,  // 3
+        0x60, 0x00, 0x00, 0x18, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x18,  // 4
+        0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFE, 0x00,  // 5
+        0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x00, 0x01, 0xF8, 0xF0, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x78, 0xFC, 0x00, 0x01, 0xF8, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x00,  // 6
+        0x7F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,  // 7
+        0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF8, 0x00, 0x01, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0, 0xF8, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xFC, 0x00, 0x03, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00,  // 8
+        0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xE0, 0xF8, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xFC, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00,  // 9
+        0x60, 0xF0, 0xF0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0xF0, 0x60,  // :
+        0x3C, 0x7C, 0x7C, 0x38, 0x00, 0x00, 0x00, 0x78, 0x78, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,  // ;
+        0x00, 0x03, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0x80,  // <
+        0x7F, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFC,  // =
+        0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xE0, 0x00, 0x00,  // >
+        0x00, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x0F, 0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x7F, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x70, 0x00, 0x00,  // ?
+        0x1F, 0xFF, 0xF0, 0x7F, 0xFF, 0xFC, 0xF8, 0x00, 0x3E, 0xF0, 0x00, 0x1E, 0xF0, 0x00, 0x1E, 0xF0, 0x7E, 0x1E, 0xF0, 0x7F, 0x1E, 0xF0, 0x03, 0x9E, 0xF1, 0xFF, 0x9E, 0xF3, 0xFF, 0x9E, 0xF7, 0x03, 0x9E, 0xF7, 0x03, 0x9E, 0xF7, 0x03, 0x9E, 0xF7, 0x03, 0x9E, 0xF3, 0xFF, 0xFE, 0xF0, 0xFF, 0xFC, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,  // @
+        0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xF0, 0x00, 0x00, 0x3E, 0x78, 0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x78, 0x3C, 0x00, 0x00, 0xF8, 0x1E, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x01, 0xE0, 0x0F, 0x80, 0x03, 0xE0, 0x07, 0x80, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x3E, 0x00, 0x00, 0x78, 0x3C, 0x00, 0x00, 0x7C, 0x78, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x1E, 0x70, 0x00, 0x00, 0x0C,  // A
+        0x7F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xF0, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x01, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xF0, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x01, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFE, 0x00,  // B
+        0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x00,  // C
+        0x7F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x03, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFE, 0x00,  // D
+        0x07, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x00,  // E
+        0x07, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,  // F
+        0x07, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0xC0, 0xF0, 0x00, 0x3F, 0xE0, 0xF0, 0x00, 0x3F, 0xE0, 0xF0, 0x00, 0x1F, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF8, 0x00, 0x07, 0xE0, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x00,  // G
+        0x60, 0x00, 0x00, 0x60, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0x60, 0x00, 0x00, 0x60,  // H
+        0x60, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x60,  // I
+        0x00, 0x60, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x03, 0xF0, 0x7F, 0xE0, 0xFF, 0xE0, 0xFF, 0x80, 0x7E, 0x00,  // J
+        0x60, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x7F, 0x00, 0xF0, 0x00, 0xFE, 0x00, 0xF0, 0x03, 0xF8, 0x00, 0xF0, 0x0F, 0xF0, 0x00, 0xF0, 0x3F, 0xC0, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0xF3, 0xFC, 0x00, 0x00, 0xF7, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xF7, 0xF8, 0x00, 0x00, 0xF1, 0xFE, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0xF0, 0x1F, 0xC0, 0x00, 0xF0, 0x07, 0xF0, 0x00, 0xF0, 0x03, 0xFC, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0x3F, 0x80, 0x60, 0x00, 0x0F, 0x00,  // K
+        0x60, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x00,  // L
+        0x70, 0x00, 0x00, 0x00, 0x38, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0xF7, 0xC0, 0x00, 0x0F, 0xBC, 0xF3, 0xE0, 0x00, 0x1F, 0x3C, 0xF1, 0xF0, 0x00, 0x3E, 0x3C, 0xF0, 0xF8, 0x00, 0x7C, 0x3C, 0xF0, 0x7C, 0x00, 0xFC, 0x3C, 0xF0, 0x7E, 0x00, 0xF8, 0x3C, 0xF0, 0x3F, 0x01, 0xF0, 0x3C, 0xF0, 0x1F, 0x03, 0xE0, 0x3C, 0xF0, 0x0F, 0x87, 0xC0, 0x3C, 0xF0, 0x07, 0xCF, 0x80, 0x3C, 0xF0, 0x03, 0xFF, 0x80, 0x3C, 0xF0, 0x03, 0xFF, 0x00, 0x3C, 0xF0, 0x01, 0xFE, 0x00, 0x3C, 0xF0, 0x00, 0xFC, 0x00, 0x3C, 0x60, 0x00, 0x78, 0x00, 0x18,  // M
+        0x70, 0x00, 0x00, 0x60, 0xF8, 0x00, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x80, 0x00, 0xF0, 0xFF, 0xC0, 0x00, 0xF0, 0xF3, 0xE0, 0x00, 0xF0, 0xF1, 0xF8, 0x00, 0xF0, 0xF0, 0xFC, 0x00, 0xF0, 0xF0, 0x7E, 0x00, 0xF0, 0xF0, 0x3F, 0x00, 0xF0, 0xF0, 0x0F, 0xC0, 0xF0, 0xF0, 0x07, 0xE0, 0xF0, 0xF0, 0x03, 0xF0, 0xF0, 0xF0, 0x01, 0xF8, 0xF0, 0xF0, 0x00, 0x7E, 0xF0, 0xF0, 0x00, 0x3F, 0xF0, 0xF0, 0x00, 0x1F, 0xF0, 0xF0, 0x00, 0x0F, 0xF0, 0xF0, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x01, 0xF0, 0x60, 0x00, 0x00, 0xE0,  // N
+        0x07, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0, 0xFC, 0x00, 0x07, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xFC, 0x00, 0x07, 0xE0, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x00,  // O
+        0x7F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xF0, 0x00, 0x03, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x07, 0xE0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,  // P
+        0x07, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF8, 0x00, 0x03, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xC0,  // Q
+        0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xF0, 0x00, 0x03, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFC, 0x00, 0xF7, 0xF8, 0x00, 0x00, 0xF1, 0xFE, 0x00, 0x00, 0xF0, 0x3F, 0xC0, 0x00, 0xF0, 0x0F, 0xF0, 0x00, 0xF0, 0x03, 0xFE, 0x00, 0xF0, 0x00, 0x7F, 0x80, 0xF0, 0x00, 0x1F, 0xC0, 0x60, 0x00, 0x07, 0x80,  // R
+        0x0F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0,  // S
+        0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x18, 0x00,  // T
+        0x60, 0x00, 0x00, 0x60, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF8, 0x00, 0x01, 0xF0, 0xFC, 0x00, 0x03, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFC, 0x00,  // U
+        0x70, 0x00, 0x00, 0x0E, 0xF8, 0x00, 0x00, 0x1F, 0x78, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x7C, 0x1F, 0x00, 0x00, 0x78, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x80, 0x01, 0xF0, 0x07, 0xC0, 0x03, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x07, 0xC0, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x78, 0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x00, 0x3E, 0x3C, 0x00, 0x00, 0x1E, 0x78, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00,  // V
+        0x70, 0x00, 0x0E, 0x00, 0x01, 0x80, 0xF8, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x78, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x3F, 0x00, 0x07, 0x80, 0x3C, 0x00, 0x7F, 0x80, 0x0F, 0x80, 0x3C, 0x00, 0x7F, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0xFB, 0xC0, 0x1F, 0x00, 0x1E, 0x00, 0xF3, 0xC0, 0x1E, 0x00, 0x0F, 0x00, 0xF1, 0xE0, 0x3E, 0x00, 0x0F, 0x01, 0xE1, 0xE0, 0x3C, 0x00, 0x07, 0x81, 0xE1, 0xF0, 0x7C, 0x00, 0x07, 0x83, 0xC0, 0xF0, 0x78, 0x00, 0x07, 0xC3, 0xC0, 0xF8, 0x78, 0x00, 0x03, 0xC7, 0xC0, 0x78, 0xF0, 0x00, 0x03, 0xE7, 0x80, 0x7C, 0xF0, 0x00, 0x01, 0xEF, 0x80, 0x3D, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00,  // W
+        0x38, 0x00, 0x00, 0xE0, 0x7C, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x07, 0xE0, 0x1F, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x1F, 0x80, 0x07, 0xE0, 0x3E, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFD, 0xF0, 0x00, 0x01, 0xF8, 0xF8, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x1F, 0x80, 0x1F, 0x80, 0x3F, 0x00, 0x07, 0xC0, 0x7E, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x01, 0xF0, 0x70, 0x00, 0x00, 0xF0,  // X
+        0x60, 0x00, 0x01, 0xC0, 0xF8, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x07, 0xE1, 0xF8, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00,  // Y
+        0x00, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x00,  // Z
+        0x7E, 0xFF, 0xFF, 0xFE, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFE, 0xFF, 0xFF, 0x7E,  // [
+        0x70, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x06,  // backslash
+        0x7E, 0xFF, 0xFF, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x7F, 0xFF, 0xFF, 0x7E,  // ]
+        0x06, 0x00, 0x0F, 0x00, 0x1F, 0x80, 0x39, 0xC0, 0x70, 0xE0, 0xE0, 0x70, 0xC0, 0x30,  // ^
+        0x7F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xC0,  // _
+        0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x06,  // `
+        0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0xF8, 0x00, 0x07, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x00,  // a
+        0x60, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x07, 0xFF, 0xF0,  // b
+        0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x00,  // c
+        0x00, 0x00, 0x06, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0,  // d
+        0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xF8, 0x00, 0x7E, 0xF0, 0x00, 0x1E, 0xF0, 0x00, 0x1E, 0xF0, 0x00, 0x1E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xF0, 0x00,  // e
+        0x0F, 0xC0, 0x3F, 0xE0, 0x7F, 0xE0, 0xFF, 0xC0, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xC0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x60, 0x00,  // f
+        0x07, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xE0,  // g
+        0x60, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x60, 0x00, 0x06,  // h
+        0x70, 0xF8, 0xF8, 0x70, 0x00, 0x30, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x30,  // i
+        0x00, 0xE0, 0x01, 0xF0, 0x01, 0xF0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xF0, 0x7F, 0xF0, 0xFF, 0xE0, 0xFF, 0xC0, 0x7F, 0x00,  // j
+        0x60, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0xE0, 0xF0, 0x03, 0xF0, 0xF0, 0x0F, 0xE0, 0xF0, 0x3F, 0x80, 0xF0, 0xFE, 0x00, 0xF3, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0xF3, 0xFC, 0x00, 0xF0, 0xFF, 0x00, 0xF0, 0x3F, 0xC0, 0xF0, 0x0F, 0xF0, 0xF0, 0x03, 0xF0, 0x60, 0x00, 0xE0,  // k
+        0x60, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x60,  // l
+        0x0F, 0xFE, 0x3F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xF8, 0x03, 0xF0, 0x0F, 0x80, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0x60, 0x00, 0xC0, 0x03, 0x00,  // m
+        0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x60, 0x00, 0x06,  // n
+        0x07, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x07, 0xFF, 0xF0,  // o
+        0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x60, 0x00, 0x00,  // p
+        0x07, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xF8, 0x00, 0x0F, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF8, 0x00, 0x07, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80,  // q
+        0x07, 0xC0, 0x3F, 0xE0, 0x7F, 0xE0, 0xFF, 0xC0, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x60, 0x00,  // r
+        0x0F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF8, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xC0,  // s
+        0x0C, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x7F, 0xF8, 0xFF, 0xFC, 0xFF, 0xFC, 0x7F, 0xF8, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x0C, 0x00,  // t
+        0x60, 0x00, 0x03, 0x00, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF8, 0x00, 0x0F, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x00,  // u
+        0x70, 0x00, 0x00, 0x70, 0xF8, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x01, 0xE0, 0x1E, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x80, 0x07, 0xC0, 0x1F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00,  // v
+        0x60, 0x00, 0xC0, 0x01, 0xC0, 0xF0, 0x01, 0xE0, 0x01, 0xE0, 0xF0, 0x01, 0xF0, 0x03, 0xC0, 0x78, 0x03, 0xF0, 0x03, 0xC0, 0x78, 0x07, 0xF8, 0x07, 0x80, 0x3C, 0x07, 0xFC, 0x07, 0x80, 0x3C, 0x0F, 0xBC, 0x0F, 0x00, 0x1E, 0x0F, 0x3E, 0x1F, 0x00, 0x1E, 0x1E, 0x1E, 0x1E, 0x00, 0x0F, 0x1E, 0x1F, 0x3E, 0x00, 0x0F, 0x3C, 0x0F, 0x3C, 0x00, 0x07, 0xBC, 0x07, 0xFC, 0x00, 0x07, 0xF8, 0x07, 0xF8, 0x00, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x01, 0xF0, 0x00, 0x01, 0xE0, 0x01, 0xE0, 0x00,  // w
+        0x70, 0x00, 0x0E, 0xF8, 0x00, 0x3F, 0x7C, 0x00, 0x7E, 0x3F, 0x00, 0xFC, 0x1F, 0x83, 0xF0, 0x07, 0xC7, 0xE0, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x07, 0xC7, 0xE0, 0x1F, 0x81, 0xF0, 0x3F, 0x00, 0xFC, 0x7C, 0x00, 0x7E, 0xF8, 0x00, 0x1F, 0x60, 0x00, 0x0E,  // x
+        0x60, 0x00, 0x03, 0x00, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x07, 0x80, 0xF8, 0x00, 0x07, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00,  // y
+        0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE,  // z
+        0x0F, 0x80, 0x1F, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x38, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x1F, 0xC0, 0x0F, 0x80,  // {
+        0x60, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x60,  // |
+        0x7C, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x3C, 0x00,  // }
+        0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0xC0, 0xFF, 0xFE, 0x01, 0xE0, 0xF0, 0x1E, 0x01, 0xE0, 0xF0, 0x0F, 0x01, 0xE0, 0xF0, 0x0F, 0x01, 0xE0, 0xF0, 0x0F, 0xFF, 0xE0, 0x60, 0x0F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00,  // ~
+        0x7F, 0xFC, 0xFF, 0xFE, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xFF, 0xFE, 0x7F, 0xFC,  // DEL
+};
+
+const packed_glyph_t Neu42x35_packed_glyphs[] = {
+        {     0, 33,  0,  0,  0,  0 },  // space
+        {     0, 33,  1,  7,  5, 22 },  // !
+        {    22, 33,  1,  7, 10,  8 },  // "
+        {    38, 33,  1,  8, 25, 21 },  // #
+        {   122, 33,  1,  5, 25, 26 },  // $
+        {   226, 33,  1,  7, 33, 23 },  // %
+        {   341, 33,  1,  7, 29, 22 },  // &
+        {   429, 33,  1,  7,  5,  8 },  // '
+        {   437, 33,  1,  7,  8, 22 },  // (
+        {   459, 33,  1,  7,  8, 22 },  // )
+        {   481, 33,  2, 10, 16, 12 },  // *
+        {   505, 33,  0, 13, 14, 10 },  // +
+        {   525, 33,  1, 24,  5,  8 },  // ,
+        {   533, 33,  1, 18, 15,  4 },  // -
+        {   541, 33,  1, 25,  5,  4 },  // .
+        {   545, 33,  0,  7, 25, 22 },  // /
+        {   633, 33,  2,  7, 26, 22 },  // 0
+        {   721, 33,  3,  7,  7, 22 },  // 1
+        {   743, 33,  1,  7, 28, 22 },  // 2
+        {   831, 33,  2,  7, 28, 22 },  // 3
+        {   919, 33,  1,  7, 30, 22 },  // 4
+        {  1007, 33,  1,  7, 28, 22 },  // 5
+        {  1095, 33,  1,  7, 29, 22 },  // 6
+        {  1183, 33,  1,  7, 28, 22 },  // 7
+        {  1271, 33,  1,  7, 28, 22 },  // 8
+        {  1359, 33,  1,  7, 28, 22 },  // 9
+        {  1447, 33,  1, 17,  4, 12 },  // :
+        {  1459, 33,  1, 17,  6, 15 },  // ;
+        {  1474, 33,  1, 11, 17, 14 },  // <
+        {  1516, 33,  1, 15, 15,  9 },  // =
+        {  1534, 33,  1, 11, 17, 14 },  // >
+        {  1576, 33,  1,  7, 18, 22 },  // ?
+        {  1642, 33,  1,  6, 23, 21 },  // @
+        {  1705, 33,  0,  7, 31, 22 },  // A
+        {  1793, 33,  1,  7, 28, 22 },  // B
+        {  1881, 33,  1,  7, 25, 22 },  // C
+        {  1969, 33,  1,  7, 28, 22 },  // D
+        {  2057, 33,  1,  7, 25, 22 },  // E
+        {  2145, 33,  1,  7, 25, 22 },  // F
+        {  2233, 33,  1,  7, 27, 22 },  // G
+        {  2321, 33,  1,  7, 28, 22 },  // H
+        {  2409, 33,  1,  7,  4, 22 },  // I
+        {  2431, 33,  1,  7, 12, 22 },  // J
+        {  2475, 33,  1,  7, 25, 22 },  // K
+        {  2563, 33,  1,  7, 25, 22 },  // L
+        {  2651, 33,  1,  7, 38, 22 },  // M
+        {  2761, 33,  1,  7, 28, 22 },  // N
+        {  2849, 33,  1,  7, 27, 22 },  // O
+        {  2937, 33,  1,  7, 27, 22 },  // P
+        {  3025, 33,  1,  7, 28, 25 },  // Q
+        {  3125, 33,  1,  7, 27, 22 },  // R
+        {  3213, 33,  1,  7, 24, 22 },  // S
+        {  3279, 33,  1,  7, 24, 22 },  // T
+        {  3345, 33,  1,  7, 28, 22 },  // U
+        {  3433, 33,  0,  7, 32, 22 },  // V
+        {  3521, 33,  0,  7, 42, 22 },  // W
+        {  3653, 33,  0,  7, 28, 22 },  // X
+        {  3741, 33,  1,  7, 27, 22 },  // Y
+        {  3829, 33,  1,  7, 25, 22 },  // Z
+        {  3917, 33,  1,  7,  8, 22 },  // [
+        {  3939, 33,  0,  7, 24, 22 },  // backslash
+        {  4005, 33,  1,  7,  8, 22 },  // ]
+        {  4027, 33,  1,  3, 12,  7 },  // ^
+        {  4041, 33,  0, 31, 27,  4 },  // _
+        {  4057, 33,  3,  4,  7,  7 },  // `
+        {  4064, 33,  1, 11, 26, 18 },  // a
+        {  4136, 33,  1,  7, 24, 22 },  // b
+        {  4202, 33,  1, 11, 25, 18 },  // c
+        {  4274, 33,  2,  7, 24, 22 },  // d
+        {  4340, 33,  1, 11, 23, 18 },  // e
+        {  4394, 33,  1,  7, 11, 22 },  // f
+        {  4438, 33,  1, 12, 24, 22 },  // g
+        {  4504, 33,  2,  7, 24, 22 },  // h
+        {  4570, 33,  1,  7,  5, 22 },  // i
+        {  4592, 33,  0,  7, 12, 26 },  // j
+        {  4644, 33,  1,  7, 20, 22 },  // k
+        {  4710, 33,  1,  7,  4, 22 },  // l
+        {  4732, 33,  1, 11, 33, 18 },  // m
+        {  4822, 33,  1, 11, 24, 18 },  // n
+        {  4876, 33,  1, 11, 24, 18 },  // o
+        {  4930, 33,  1, 11, 24, 23 },  // p
+        {  4999, 33,  1, 11, 25, 23 },  // q
+        {  5091, 33,  1, 11, 11, 18 },  // r
+        {  5127, 33,  1, 11, 21, 18 },  // s
+        {  5181, 33,  0,  7, 14, 22 },  // t
+        {  5225, 33,  1, 12, 25, 17 },  // u
+        {  5293, 33,  0, 12, 29, 18 },  // v
+        {  5365, 33,  1, 12, 35, 17 },  // w
+        {  5450, 33,  1, 12, 24, 17 },  // x
+        {  5501, 33,  1, 12, 25, 22 },  // y
+        {  5589, 33,  1, 12, 24, 17 },  // z
+        {  5640, 33,  1,  3, 10, 29 },  // {
+        {  5698, 33,  1,  5,  4, 29 },  // |
+        {  5727, 33,  1,  3, 10, 29 },  // }
+        {  5785, 33,  1,  9, 27, 11 },  // ~
+        {  5829, 33,  2,  0, 15, 29 },  // DEL
+};
+
+const packed_font_t Neu42x35_packed = { 32, 127, 42, 35, PACKED_FONT_BITS, Neu42x35_packed_glyphs, Neu42x35_packed_bitmap };
+
+#endif
@@ -0,0 +1,206 @@
+// generated by fontcompiler.py from font_big.h - do not edit
+#ifndef _NEU42X35_RUNS_H_
+#define _NEU42X35_RUNS_H_
+
+#include "PackedFont.h"
+
+const uint8_t Neu42x35_runs_bitmap[] = {
+        0x2C, 0x00, 0x30, 0x00, 0x33, 0x00, 0x36, 0x00, 0x39, 0x00, 0x3C, 0x00, 0x3F, 0x00, 0x42, 0x00, 0x45, 0x00, 0x48, 0x00, 0x4B, 0x00, 0x4E, 0x00, 0x51, 0x00, 0x54, 0x00, 0x57, 0x00, 0x5A, 0x00, 0x5D, 0x00, 0x61, 0x00, 0x63, 0x00, 0x67, 0x00, 0x6A, 0x00, 0x6D, 0x00, 0x03, 0x02, 0x02, 0x01, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x03, 0x02, 0x02, 0x01, 0x01, 0x05, 0x03, 0x01, 0x03, 0x01, 0x02, 0x00, 0x05, 0x02, 0x00, 0x05, 0x03, 0x01, 0x03, 0x01,  // !
+        0x10, 0x00, 0x15, 0x00, 0x1A, 0x00, 0x1F, 0x00, 0x24, 0x00, 0x29, 0x00, 0x2F, 0x00, 0x35, 0x00, 0x04, 0x02, 0x03, 0x02, 0x03, 0x04, 0x01, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x01, 0x04, 0x04, 0x00, 0x05, 0x01, 0x04, 0x05, 0x00, 0x04, 0x01, 0x04, 0x01, 0x05, 0x00, 0x04, 0x01, 0x04, 0x01, 0x05, 0x00, 0x03, 0x02, 0x03, 0x02,  // "
+        0x2A, 0x00, 0x30, 0x00, 0x36, 0x00, 0x3C, 0x00, 0x42, 0x00, 0x48, 0x00, 0x4C, 0x00, 0x4F, 0x00, 0x52, 0x00, 0x56, 0x00, 0x5C, 0x00, 0x62, 0x00, 0x66, 0x00, 0x6A, 0x00, 0x6E, 0x00, 0x72, 0x00, 0x78, 0x00, 0x7E, 0x00, 0x84, 0x00, 0x8A, 0x00, 0x90, 0x00, 0x05, 0x0B, 0x02, 0x05, 0x02, 0x05, 0x05, 0x0A, 0x04, 0x03, 0x04, 0x04, 0x05, 0x09, 0x05, 0x03, 0x04, 0x04, 0x05, 0x09, 0x05, 0x02, 0x05, 0x04, 0x05, 0x08, 0x05, 0x03, 0x04, 0x05, 0x03, 0x03, 0x15, 0x01, 0x02, 0x02, 0x17, 0x02, 0x02, 0x17, 0x03, 0x03, 0x15, 0x01, 0x05, 0x07, 0x04, 0x04, 0x04, 0x06, 0x05, 0x06, 0x04, 0x04, 0x04, 0x07, 0x03, 0x01, 0x15, 0x03, 0x03, 0x00, 0x17, 0x02, 0x03, 0x00, 0x17, 0x02, 0x03, 0x01, 0x15, 0x03, 0x05, 0x05, 0x04, 0x03, 0x04, 0x09, 0x05, 0x04, 0x04, 0x04, 0x04, 0x09, 0x05, 0x04, 0x04, 0x03, 0x04, 0x0A, 0x05, 0x03, 0x04, 0x03, 0x05, 0x0A, 0x05, 0x03, 0x04, 0x03, 0x04, 0x0B, 0x05, 0x04, 0x02, 0x05, 0x02, 0x0C,  // #
+        0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x40, 0x00, 0x44, 0x00, 0x48, 0x00, 0x4C, 0x00, 0x52, 0x00, 0x58, 0x00, 0x5E, 0x00, 0x64, 0x00, 0x6A, 0x00, 0x6E, 0x00, 0x72, 0x00, 0x76, 0x00, 0x79, 0x00, 0x7E, 0x00, 0x83, 0x00, 0x88, 0x00, 0x8D, 0x00, 0x92, 0x00, 0x95, 0x00, 0x99, 0x00, 0x9D, 0x00, 0xA1, 0x00, 0xA5, 0x00, 0x03, 0x0B, 0x02, 0x0C, 0x03, 0x0A, 0x04, 0x0B, 0x03, 0x04, 0x0E, 0x07, 0x03, 0x03, 0x10, 0x06, 0x03, 0x02, 0x11, 0x06, 0x03, 0x01, 0x11, 0x07, 0x05, 0x00, 0x04, 0x06, 0x04, 0x0B, 0x05, 0x00, 0x04, 0x06, 0x04, 0x0B, 0x05, 0x00, 0x04, 0x06, 0x04, 0x0B, 0x05, 0x00, 0x04, 0x06, 0x04, 0x0B, 0x05, 0x00, 0x05, 0x05, 0x04, 0x0B, 0x03, 0x00, 0x15, 0x04, 0x03, 0x01, 0x16, 0x02, 0x03, 0x02, 0x16, 0x01, 0x02, 0x05, 0x14, 0x04, 0x0A, 0x04, 0x06, 0x05, 0x04, 0x0A, 0x04, 0x07, 0x04, 0x04, 0x0A, 0x04, 0x07, 0x04, 0x04, 0x0A, 0x04, 0x07, 0x04, 0x04, 0x0A, 0x04, 0x06, 0x05, 0x02, 0x01, 0x18, 0x03, 0x00, 0x18, 0x01, 0x03, 0x00, 0x16, 0x03, 0x03, 0x01, 0x13, 0x05, 0x03, 0x0A, 0x04, 0x0B, 0x03, 0x0B, 0x02, 0x0C,  // $
+        0x2E, 0x00, 0x34, 0x00, 0x3A, 0x00, 0x40, 0x00, 0x46, 0x00, 0x4E, 0x00, 0x56, 0x00, 0x5E, 0x00, 0x64, 0x00, 0x68, 0x00, 0x6C, 0x00, 0x72, 0x00, 0x76, 0x00, 0x7C, 0x00, 0x82, 0x00, 0x87, 0x00, 0x8C, 0x00, 0x93, 0x00, 0x9A, 0x00, 0xA1, 0x00, 0xA6, 0x00, 0xAC, 0x00, 0xB2, 0x00, 0x05, 0x03, 0x0A, 0x0C, 0x04, 0x04, 0x05, 0x01, 0x0E, 0x09, 0x05, 0x04, 0x05, 0x00, 0x10, 0x07, 0x05, 0x05, 0x05, 0x00, 0x10, 0x05, 0x06, 0x06, 0x07, 0x00, 0x05, 0x06, 0x05, 0x04, 0x06, 0x07, 0x07, 0x00, 0x04, 0x08, 0x04, 0x03, 0x06, 0x08, 0x07, 0x00, 0x05, 0x06, 0x05, 0x02, 0x06, 0x09, 0x05, 0x00, 0x10, 0x01, 0x06, 0x0A, 0x03, 0x00, 0x16, 0x0B, 0x03, 0x01, 0x14, 0x0C, 0x05, 0x03, 0x09, 0x02, 0x06, 0x0D, 0x03, 0x0D, 0x06, 0x0E, 0x05, 0x0C, 0x06, 0x02, 0x0A, 0x03, 0x05, 0x0B, 0x06, 0x01, 0x0E, 0x01, 0x04, 0x0A, 0x06, 0x01, 0x10, 0x04, 0x09, 0x06, 0x02, 0x10, 0x06, 0x08, 0x06, 0x03, 0x05, 0x07, 0x04, 0x06, 0x07, 0x06, 0x04, 0x04, 0x08, 0x04, 0x06, 0x06, 0x06, 0x05, 0x05, 0x06, 0x05, 0x04, 0x05, 0x06, 0x06, 0x10, 0x05, 0x04, 0x06, 0x07, 0x0F, 0x01, 0x05, 0x05, 0x04, 0x09, 0x0D, 0x02, 0x03, 0x14, 0x08, 0x05,  // %
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x42, 0x00, 0x48, 0x00, 0x4E, 0x00, 0x54, 0x00, 0x5A, 0x00, 0x60, 0x00, 0x66, 0x00, 0x6C, 0x00, 0x74, 0x00, 0x7C, 0x00, 0x84, 0x00, 0x8C, 0x00, 0x92, 0x00, 0x98, 0x00, 0x9C, 0x00, 0x9F, 0x00, 0xA2, 0x00, 0x03, 0x06, 0x0C, 0x0B, 0x03, 0x04, 0x10, 0x09, 0x03, 0x03, 0x12, 0x08, 0x03, 0x03, 0x13, 0x07, 0x05, 0x02, 0x05, 0x0A, 0x05, 0x07, 0x05, 0x02, 0x04, 0x0C, 0x04, 0x07, 0x05, 0x02, 0x04, 0x0C, 0x04, 0x07, 0x05, 0x03, 0x04, 0x0A, 0x05, 0x07, 0x05, 0x03, 0x05, 0x07, 0x06, 0x08, 0x05, 0x05, 0x05, 0x01, 0x08, 0x0A, 0x05, 0x05, 0x0C, 0x07, 0x02, 0x03, 0x05, 0x02, 0x0D, 0x08, 0x04, 0x02, 0x07, 0x01, 0x07, 0x02, 0x07, 0x06, 0x04, 0x02, 0x07, 0x00, 0x06, 0x06, 0x06, 0x05, 0x04, 0x02, 0x07, 0x00, 0x04, 0x0A, 0x06, 0x03, 0x04, 0x02, 0x07, 0x00, 0x04, 0x0C, 0x06, 0x01, 0x04, 0x02, 0x05, 0x00, 0x04, 0x0D, 0x0A, 0x02, 0x05, 0x00, 0x05, 0x0E, 0x08, 0x02, 0x03, 0x00, 0x1B, 0x02, 0x02, 0x01, 0x1C, 0x02, 0x03, 0x1A, 0x05, 0x05, 0x11, 0x03, 0x03, 0x01,  // &
+        0x10, 0x00, 0x13, 0x00, 0x16, 0x00, 0x19, 0x00, 0x1C, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x02, 0x02, 0x03, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x00, 0x05, 0x03, 0x00, 0x04, 0x01, 0x03, 0x00, 0x04, 0x01, 0x03, 0x00, 0x03, 0x02,  // '
+        0x2C, 0x00, 0x30, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x57, 0x00, 0x5B, 0x00, 0x5F, 0x00, 0x63, 0x00, 0x67, 0x00, 0x6B, 0x00, 0x6F, 0x00, 0x73, 0x00, 0x77, 0x00, 0x7B, 0x00, 0x7E, 0x00, 0x03, 0x04, 0x03, 0x01, 0x02, 0x03, 0x05, 0x03, 0x02, 0x05, 0x01, 0x03, 0x01, 0x05, 0x02, 0x03, 0x00, 0x05, 0x03, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x05, 0x03, 0x03, 0x01, 0x05, 0x02, 0x03, 0x02, 0x05, 0x01, 0x02, 0x03, 0x05, 0x03, 0x04, 0x03, 0x01,  // (
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x3F, 0x00, 0x42, 0x00, 0x45, 0x00, 0x48, 0x00, 0x4B, 0x00, 0x4E, 0x00, 0x51, 0x00, 0x54, 0x00, 0x57, 0x00, 0x5A, 0x00, 0x5D, 0x00, 0x60, 0x00, 0x63, 0x00, 0x66, 0x00, 0x6A, 0x00, 0x6E, 0x00, 0x72, 0x00, 0x03, 0x01, 0x03, 0x04, 0x03, 0x00, 0x05, 0x03, 0x03, 0x01, 0x05, 0x02, 0x03, 0x02, 0x05, 0x01, 0x02, 0x03, 0x05, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x03, 0x05, 0x03, 0x02, 0x05, 0x01, 0x03, 0x01, 0x05, 0x02, 0x03, 0x00, 0x05, 0x03, 0x03, 0x01, 0x03, 0x04,  // )
+        0x18, 0x00, 0x1C, 0x00, 0x24, 0x00, 0x2B, 0x00, 0x32, 0x00, 0x36, 0x00, 0x3A, 0x00, 0x3E, 0x00, 0x42, 0x00, 0x49, 0x00, 0x50, 0x00, 0x58, 0x00, 0x03, 0x07, 0x02, 0x07, 0x07, 0x01, 0x02, 0x03, 0x04, 0x03, 0x02, 0x01, 0x06, 0x00, 0x04, 0x02, 0x04, 0x02, 0x04, 0x06, 0x00, 0x05, 0x01, 0x04, 0x01, 0x05, 0x03, 0x01, 0x0E, 0x01, 0x03, 0x02, 0x0C, 0x02, 0x03, 0x02, 0x0C, 0x02, 0x03, 0x01, 0x0E, 0x01, 0x06, 0x00, 0x05, 0x01, 0x04, 0x01, 0x05, 0x06, 0x00, 0x04, 0x02, 0x04, 0x02, 0x04, 0x07, 0x01, 0x02, 0x03, 0x04, 0x03, 0x02, 0x01, 0x03, 0x07, 0x02, 0x07,  // *
+        0x14, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x20, 0x00, 0x24, 0x00, 0x27, 0x00, 0x2A, 0x00, 0x2E, 0x00, 0x32, 0x00, 0x36, 0x00, 0x03, 0x06, 0x02, 0x06, 0x03, 0x05, 0x04, 0x05, 0x03, 0x05, 0x04, 0x05, 0x03, 0x01, 0x0C, 0x01, 0x02, 0x00, 0x0E, 0x02, 0x00, 0x0E, 0x03, 0x01, 0x0C, 0x01, 0x03, 0x05, 0x04, 0x05, 0x03, 0x05, 0x04, 0x05, 0x03, 0x06, 0x02, 0x06,  // +
+        0x10, 0x00, 0x13, 0x00, 0x16, 0x00, 0x19, 0x00, 0x1C, 0x00, 0x20, 0x00, 0x24, 0x00, 0x28, 0x00, 0x02, 0x02, 0x03, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x03, 0x00, 0x04, 0x01, 0x03, 0x00, 0x04, 0x01, 0x03, 0x00, 0x04, 0x01, 0x03, 0x00, 0x03, 0x02,  // ,
+        0x08, 0x00, 0x0B, 0x00, 0x0E, 0x00, 0x11, 0x00, 0x02, 0x01, 0x0E, 0x02, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x03, 0x00, 0x0E, 0x01,  // -
+        0x08, 0x00, 0x0C, 0x00, 0x0F, 0x00, 0x12, 0x00, 0x03, 0x01, 0x03, 0x01, 0x02, 0x00, 0x05, 0x02, 0x00, 0x05, 0x03, 0x01, 0x03, 0x01,  // .
+        0x2C, 0x00, 0x30, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x57, 0x00, 0x5B, 0x00, 0x5F, 0x00, 0x63, 0x00, 0x67, 0x00, 0x6B, 0x00, 0x6F, 0x00, 0x73, 0x00, 0x77, 0x00, 0x7B, 0x00, 0x7F, 0x00, 0x03, 0x16, 0x02, 0x01, 0x02, 0x14, 0x05, 0x03, 0x13, 0x05, 0x01, 0x03, 0x12, 0x05, 0x02, 0x03, 0x11, 0x05, 0x03, 0x03, 0x10, 0x05, 0x04, 0x03, 0x0F, 0x05, 0x05, 0x03, 0x0D, 0x06, 0x06, 0x03, 0x0C, 0x06, 0x07, 0x03, 0x0B, 0x06, 0x08, 0x03, 0x0A, 0x06, 0x09, 0x03, 0x09, 0x06, 0x0A, 0x03, 0x08, 0x06, 0x0B, 0x03, 0x07, 0x06, 0x0C, 0x03, 0x06, 0x06, 0x0D, 0x03, 0x05, 0x06, 0x0E, 0x03, 0x04, 0x05, 0x10, 0x03, 0x03, 0x05, 0x11, 0x03, 0x02, 0x05, 0x12, 0x03, 0x01, 0x05, 0x13, 0x03, 0x00, 0x05, 0x14, 0x03, 0x01, 0x03, 0x15,  // /
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x41, 0x00, 0x46, 0x00, 0x4B, 0x00, 0x50, 0x00, 0x55, 0x00, 0x5A, 0x00, 0x5F, 0x00, 0x64, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x78, 0x00, 0x7D, 0x00, 0x82, 0x00, 0x86, 0x00, 0x8A, 0x00, 0x8E, 0x00, 0x03, 0x05, 0x10, 0x05, 0x03, 0x02, 0x16, 0x02, 0x03, 0x01, 0x18, 0x01, 0x03, 0x01, 0x18, 0x01, 0x04, 0x00, 0x06, 0x0E, 0x06, 0x04, 0x00, 0x04, 0x12, 0x04, 0x04, 0x00, 0x04, 0x12, 0x04, 0x04, 0x00, 0x04, 0x12, 0x04, 0x04, 0x00, 0x04, 0x12, 0x04, 0x04, 0x00, 0x04, 0x12, 0x04, 0x04, 0x00, 0x04, 0x12, 0x04, 0x04, 0x00, 0x04, 0x12, 0x04, 0x04, 0x00, 0x04, 0x12, 0x04, 0x04, 0x00, 0x04, 0x12, 0x04, 0x04, 0x00, 0x04, 0x12, 0x04, 0x04, 0x00, 0x04, 0x12, 0x04, 0x04, 0x00, 0x04, 0x12, 0x04, 0x04, 0x00, 0x06, 0x0F, 0x05, 0x03, 0x00, 0x19, 0x01, 0x03, 0x01, 0x18, 0x01, 0x03, 0x02, 0x16, 0x02, 0x03, 0x05, 0x10, 0x05,  // 0
+        0x2C, 0x00, 0x30, 0x00, 0x33, 0x00, 0x36, 0x00, 0x39, 0x00, 0x3C, 0x00, 0x3F, 0x00, 0x42, 0x00, 0x45, 0x00, 0x48, 0x00, 0x4B, 0x00, 0x4E, 0x00, 0x51, 0x00, 0x54, 0x00, 0x57, 0x00, 0x5A, 0x00, 0x5D, 0x00, 0x60, 0x00, 0x63, 0x00, 0x66, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x03, 0x01, 0x05, 0x01, 0x02, 0x00, 0x07, 0x02, 0x00, 0x07, 0x02, 0x01, 0x06, 0x02, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x03, 0x04, 0x03, 0x04, 0x02, 0x01,  // 1
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3B, 0x00, 0x3E, 0x00, 0x41, 0x00, 0x44, 0x00, 0x47, 0x00, 0x4A, 0x00, 0x4E, 0x00, 0x52, 0x00, 0x56, 0x00, 0x5A, 0x00, 0x5E, 0x00, 0x62, 0x00, 0x66, 0x00, 0x6A, 0x00, 0x6E, 0x00, 0x72, 0x00, 0x75, 0x00, 0x78, 0x00, 0x03, 0x0E, 0x0A, 0x04, 0x03, 0x0D, 0x0D, 0x02, 0x03, 0x0D, 0x0E, 0x01, 0x02, 0x0E, 0x0E, 0x02, 0x17, 0x05, 0x02, 0x18, 0x04, 0x02, 0x18, 0x04, 0x02, 0x18, 0x04, 0x02, 0x17, 0x05, 0x03, 0x05, 0x16, 0x01, 0x03, 0x02, 0x19, 0x01, 0x03, 0x01, 0x19, 0x02, 0x03, 0x00, 0x17, 0x05, 0x03, 0x00, 0x05, 0x17, 0x03, 0x00, 0x04, 0x18, 0x03, 0x00, 0x04, 0x18, 0x03, 0x00, 0x04, 0x18, 0x03, 0x00, 0x04, 0x18, 0x03, 0x00, 0x1B, 0x01, 0x02, 0x00, 0x1C, 0x02, 0x00, 0x1C, 0x03, 0x01, 0x1A, 0x01,  // 2
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3B, 0x00, 0x3E, 0x00, 0x41, 0x00, 0x44, 0x00, 0x47, 0x00, 0x4A, 0x00, 0x4E, 0x00, 0x52, 0x00, 0x56, 0x00, 0x59, 0x00, 0x5C, 0x00, 0x5F, 0x00, 0x62, 0x00, 0x65, 0x00, 0x68, 0x00, 0x6B, 0x00, 0x6F, 0x00, 0x73, 0x00, 0x03, 0x0F, 0x09, 0x04, 0x03, 0x0E, 0x0C, 0x02, 0x03, 0x0E, 0x0D, 0x01, 0x02, 0x0F, 0x0D, 0x02, 0x17, 0x05, 0x02, 0x18, 0x04, 0x02, 0x18, 0x04, 0x02, 0x18, 0x04, 0x02, 0x17, 0x05, 0x03, 0x01, 0x1A, 0x01, 0x03, 0x00, 0x1B, 0x01, 0x03, 0x00, 0x1B, 0x01, 0x02, 0x01, 0x1B, 0x02, 0x17, 0x05, 0x02, 0x18, 0x04, 0x02, 0x18, 0x04, 0x02, 0x18, 0x04, 0x02, 0x17, 0x05, 0x02, 0x01, 0x1B, 0x03, 0x00, 0x1B, 0x01, 0x03, 0x00, 0x1A, 0x02, 0x03, 0x01, 0x16, 0x05,  // 3
+        0x2C, 0x00, 0x32, 0x00, 0x37, 0x00, 0x3C, 0x00, 0x41, 0x00, 0x46, 0x00, 0x4B, 0x00, 0x50, 0x00, 0x55, 0x00, 0x5A, 0x00, 0x5F, 0x00, 0x64, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x71, 0x00, 0x74, 0x00, 0x77, 0x00, 0x7A, 0x00, 0x7D, 0x00, 0x80, 0x00, 0x83, 0x00, 0x86, 0x00, 0x05, 0x01, 0x02, 0x18, 0x02, 0x01, 0x04, 0x00, 0x04, 0x16, 0x04, 0x04, 0x00, 0x04, 0x16, 0x04, 0x04, 0x00, 0x04, 0x16, 0x04, 0x04, 0x00, 0x04, 0x16, 0x04, 0x04, 0x00, 0x04, 0x16, 0x04, 0x04, 0x00, 0x04, 0x16, 0x04, 0x04, 0x00, 0x04, 0x16, 0x04, 0x04, 0x00, 0x04, 0x16, 0x04, 0x04, 0x00, 0x04, 0x16, 0x04, 0x04, 0x00, 0x04, 0x16, 0x04, 0x04, 0x00, 0x04, 0x16, 0x04, 0x04, 0x00, 0x04, 0x16, 0x04, 0x02, 0x00, 0x1E, 0x02, 0x00, 0x1E, 0x02, 0x00, 0x1E, 0x02, 0x01, 0x1D, 0x02, 0x1A, 0x04, 0x02, 0x1A, 0x04, 0x02, 0x1A, 0x04, 0x02, 0x1A, 0x04, 0x03, 0x1B, 0x02, 0x01,  // 4
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x40, 0x00, 0x44, 0x00, 0x48, 0x00, 0x4C, 0x00, 0x50, 0x00, 0x54, 0x00, 0x58, 0x00, 0x5B, 0x00, 0x5E, 0x00, 0x61, 0x00, 0x64, 0x00, 0x67, 0x00, 0x6A, 0x00, 0x6D, 0x00, 0x70, 0x00, 0x74, 0x00, 0x78, 0x00, 0x03, 0x01, 0x0E, 0x0D, 0x03, 0x00, 0x10, 0x0C, 0x03, 0x00, 0x10, 0x0C, 0x03, 0x00, 0x0F, 0x0D, 0x03, 0x00, 0x04, 0x18, 0x03, 0x00, 0x04, 0x18, 0x03, 0x00, 0x04, 0x18, 0x03, 0x00, 0x17, 0x05, 0x03, 0x00, 0x19, 0x03, 0x03, 0x00, 0x1B, 0x01, 0x03, 0x01, 0x1A, 0x01, 0x02, 0x16, 0x06, 0x02, 0x18, 0x04, 0x02, 0x18, 0x04, 0x02, 0x18, 0x04, 0x02, 0x18, 0x04, 0x02, 0x18, 0x04, 0x02, 0x17, 0x05, 0x02, 0x01, 0x1B, 0x03, 0x00, 0x1B, 0x01, 0x03, 0x00, 0x1A, 0x02, 0x03, 0x01, 0x16, 0x05,  // 5
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x40, 0x00, 0x44, 0x00, 0x48, 0x00, 0x4C, 0x00, 0x50, 0x00, 0x54, 0x00, 0x58, 0x00, 0x5D, 0x00, 0x62, 0x00, 0x67, 0x00, 0x6C, 0x00, 0x71, 0x00, 0x76, 0x00, 0x7B, 0x00, 0x7E, 0x00, 0x82, 0x00, 0x86, 0x00, 0x03, 0x05, 0x0A, 0x0E, 0x03, 0x03, 0x0D, 0x0D, 0x03, 0x01, 0x0F, 0x0D, 0x03, 0x00, 0x0F, 0x0E, 0x03, 0x00, 0x05, 0x18, 0x03, 0x00, 0x04, 0x19, 0x03, 0x00, 0x04, 0x19, 0x03, 0x00, 0x18, 0x05, 0x03, 0x00, 0x1A, 0x03, 0x03, 0x00, 0x1C, 0x01, 0x03, 0x00, 0x1C, 0x01, 0x04, 0x00, 0x04, 0x13, 0x06, 0x04, 0x00, 0x04, 0x15, 0x04, 0x04, 0x00, 0x04, 0x15, 0x04, 0x04, 0x00, 0x04, 0x15, 0x04, 0x04, 0x00, 0x04, 0x15, 0x04, 0x04, 0x00, 0x04, 0x15, 0x04, 0x04, 0x00, 0x06, 0x11, 0x06, 0x02, 0x01, 0x1C, 0x03, 0x01, 0x1B, 0x01, 0x03, 0x02, 0x19, 0x02, 0x03, 0x05, 0x13, 0x05,  // 6
+        0x2C, 0x00, 0x30, 0x00, 0x33, 0x00, 0x36, 0x00, 0x3A, 0x00, 0x3E, 0x00, 0x42, 0x00, 0x46, 0x00, 0x4A, 0x00, 0x4E, 0x00, 0x52, 0x00, 0x56, 0x00, 0x5A, 0x00, 0x5E, 0x00, 0x62, 0x00, 0x66, 0x00, 0x6A, 0x00, 0x6E, 0x00, 0x72, 0x00, 0x76, 0x00, 0x7A, 0x00, 0x7E, 0x00, 0x03, 0x01, 0x1A, 0x01, 0x02, 0x00, 0x1C, 0x02, 0x00, 0x1C, 0x03, 0x01, 0x1A, 0x01, 0x03, 0x16, 0x04, 0x02, 0x03, 0x15, 0x04, 0x03, 0x03, 0x14, 0x04, 0x04, 0x03, 0x13, 0x05, 0x04, 0x03, 0x12, 0x05, 0x05, 0x03, 0x12, 0x04, 0x06, 0x03, 0x11, 0x04, 0x07, 0x03, 0x10, 0x04, 0x08, 0x03, 0x0F, 0x04, 0x09, 0x03, 0x0E, 0x05, 0x09, 0x03, 0x0D, 0x05, 0x0A, 0x03, 0x0C, 0x05, 0x0B, 0x03, 0x0B, 0x05, 0x0C, 0x03, 0x0A, 0x05, 0x0D, 0x03, 0x0A, 0x04, 0x0E, 0x03, 0x09, 0x04, 0x0F, 0x03, 0x08, 0x05, 0x0F, 0x03, 0x09, 0x03, 0x10,  // 7
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3B, 0x00, 0x40, 0x00, 0x45, 0x00, 0x4A, 0x00, 0x4F, 0x00, 0x54, 0x00, 0x58, 0x00, 0x5C, 0x00, 0x60, 0x00, 0x64, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x78, 0x00, 0x7D, 0x00, 0x80, 0x00, 0x84, 0x00, 0x88, 0x00, 0x03, 0x05, 0x12, 0x05, 0x03, 0x02, 0x18, 0x02, 0x03, 0x01, 0x1A, 0x01, 0x02, 0x00, 0x1C, 0x04, 0x00, 0x06, 0x10, 0x06, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x05, 0x12, 0x05, 0x03, 0x01, 0x1A, 0x01, 0x03, 0x01, 0x19, 0x02, 0x03, 0x02, 0x18, 0x02, 0x03, 0x01, 0x1A, 0x01, 0x04, 0x00, 0x05, 0x11, 0x06, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x06, 0x10, 0x06, 0x02, 0x00, 0x1C, 0x03, 0x01, 0x1A, 0x01, 0x03, 0x03, 0x16, 0x03, 0x03, 0x05, 0x12, 0x05,  // 8
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x41, 0x00, 0x46, 0x00, 0x4B, 0x00, 0x50, 0x00, 0x55, 0x00, 0x5A, 0x00, 0x5F, 0x00, 0x62, 0x00, 0x65, 0x00, 0x68, 0x00, 0x6B, 0x00, 0x6E, 0x00, 0x71, 0x00, 0x74, 0x00, 0x77, 0x00, 0x7B, 0x00, 0x7F, 0x00, 0x03, 0x05, 0x12, 0x05, 0x03, 0x03, 0x16, 0x03, 0x03, 0x01, 0x1A, 0x01, 0x03, 0x01, 0x1A, 0x01, 0x04, 0x00, 0x05, 0x11, 0x06, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x06, 0x12, 0x04, 0x02, 0x00, 0x1C, 0x02, 0x01, 0x1B, 0x02, 0x02, 0x1A, 0x02, 0x05, 0x17, 0x02, 0x18, 0x04, 0x02, 0x18, 0x04, 0x02, 0x17, 0x05, 0x02, 0x0E, 0x0E, 0x03, 0x0D, 0x0E, 0x01, 0x03, 0x0D, 0x0C, 0x03, 0x03, 0x0E, 0x09, 0x05,  // 9
+        0x18, 0x00, 0x1C, 0x00, 0x1F, 0x00, 0x22, 0x00, 0x26, 0x00, 0x28, 0x00, 0x2A, 0x00, 0x2C, 0x00, 0x2E, 0x00, 0x32, 0x00, 0x35, 0x00, 0x38, 0x00, 0x03, 0x01, 0x02, 0x01, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x03, 0x01, 0x02, 0x01, 0x01, 0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x04, 0x03, 0x01, 0x02, 0x01, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x03, 0x01, 0x02, 0x01,  // :
+        0x1E, 0x00, 0x21, 0x00, 0x24, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2D, 0x00, 0x2F, 0x00, 0x31, 0x00, 0x35, 0x00, 0x39, 0x00, 0x3D, 0x00, 0x41, 0x00, 0x45, 0x00, 0x49, 0x00, 0x4D, 0x00, 0x02, 0x02, 0x04, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x03, 0x02, 0x03, 0x01, 0x01, 0x06, 0x01, 0x06, 0x01, 0x06, 0x03, 0x01, 0x04, 0x01, 0x03, 0x01, 0x04, 0x01, 0x03, 0x01, 0x04, 0x01, 0x03, 0x00, 0x04, 0x02, 0x03, 0x00, 0x04, 0x02, 0x03, 0x00, 0x04, 0x02, 0x03, 0x00, 0x04, 0x02, 0x03, 0x00, 0x04, 0x02,  // ;
+        0x1C, 0x00, 0x1F, 0x00, 0x22, 0x00, 0x26, 0x00, 0x2A, 0x00, 0x2E, 0x00, 0x32, 0x00, 0x36, 0x00, 0x3A, 0x00, 0x3E, 0x00, 0x42, 0x00, 0x46, 0x00, 0x4A, 0x00, 0x4D, 0x00, 0x02, 0x0E, 0x03, 0x02, 0x0B, 0x06, 0x03, 0x09, 0x06, 0x02, 0x03, 0x07, 0x06, 0x04, 0x03, 0x04, 0x06, 0x07, 0x03, 0x02, 0x06, 0x09, 0x03, 0x00, 0x05, 0x0C, 0x03, 0x00, 0x05, 0x0C, 0x03, 0x02, 0x06, 0x09, 0x03, 0x04, 0x06, 0x07, 0x03, 0x07, 0x06, 0x04, 0x03, 0x09, 0x06, 0x02, 0x02, 0x0B, 0x06, 0x02, 0x0E, 0x03,  // <
+        0x12, 0x00, 0x15, 0x00, 0x18, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x21, 0x00, 0x24, 0x00, 0x27, 0x00, 0x2A, 0x00, 0x02, 0x01, 0x0E, 0x02, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x03, 0x00, 0x0E, 0x01, 0x01, 0x0F, 0x02, 0x01, 0x0E, 0x02, 0x00, 0x0F, 0x02, 0x00, 0x0F, 0x03, 0x00, 0x0E, 0x01,  // =
+        0x1C, 0x00, 0x20, 0x00, 0x24, 0x00, 0x28, 0x00, 0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x37, 0x00, 0x3A, 0x00, 0x3E, 0x00, 0x42, 0x00, 0x46, 0x00, 0x4A, 0x00, 0x4E, 0x00, 0x03, 0x00, 0x03, 0x0E, 0x03, 0x00, 0x06, 0x0B, 0x03, 0x02, 0x06, 0x09, 0x03, 0x04, 0x06, 0x07, 0x03, 0x07, 0x06, 0x04, 0x03, 0x09, 0x06, 0x02, 0x02, 0x0C, 0x05, 0x02, 0x0C, 0x05, 0x03, 0x09, 0x06, 0x02, 0x03, 0x07, 0x05, 0x05, 0x03, 0x04, 0x06, 0x07, 0x03, 0x02, 0x06, 0x09, 0x03, 0x00, 0x05, 0x0C, 0x03, 0x00, 0x03, 0x0E,  // >
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x3F, 0x00, 0x42, 0x00, 0x45, 0x00, 0x48, 0x00, 0x4B, 0x00, 0x4E, 0x00, 0x51, 0x00, 0x55, 0x00, 0x59, 0x00, 0x5D, 0x00, 0x61, 0x00, 0x65, 0x00, 0x69, 0x00, 0x6B, 0x00, 0x6F, 0x00, 0x73, 0x00, 0x77, 0x00, 0x03, 0x08, 0x05, 0x05, 0x03, 0x07, 0x08, 0x03, 0x03, 0x07, 0x0A, 0x01, 0x03, 0x08, 0x09, 0x01, 0x02, 0x0C, 0x06, 0x02, 0x0E, 0x04, 0x02, 0x0E, 0x04, 0x02, 0x0E, 0x04, 0x02, 0x0E, 0x04, 0x02, 0x0D, 0x05, 0x02, 0x04, 0x0E, 0x03, 0x02, 0x0F, 0x01, 0x03, 0x01, 0x0F, 0x02, 0x03, 0x01, 0x0C, 0x05, 0x03, 0x01, 0x04, 0x0D, 0x03, 0x01, 0x04, 0x0D, 0x03, 0x01, 0x03, 0x0E, 0x01, 0x12, 0x03, 0x01, 0x03, 0x0E, 0x03, 0x00, 0x05, 0x0D, 0x03, 0x00, 0x05, 0x0D, 0x03, 0x01, 0x03, 0x0E,  // ?
+        0x2A, 0x00, 0x2E, 0x00, 0x32, 0x00, 0x37, 0x00, 0x3C, 0x00, 0x41, 0x00, 0x48, 0x00, 0x4F, 0x00, 0x56, 0x00, 0x5D, 0x00, 0x64, 0x00, 0x6D, 0x00, 0x76, 0x00, 0x7F, 0x00, 0x88, 0x00, 0x8D, 0x00, 0x93, 0x00, 0x97, 0x00, 0x9B, 0x00, 0x9F, 0x00, 0xA3, 0x00, 0x03, 0x03, 0x11, 0x03, 0x03, 0x01, 0x15, 0x01, 0x04, 0x00, 0x05, 0x0D, 0x05, 0x04, 0x00, 0x04, 0x0F, 0x04, 0x04, 0x00, 0x04, 0x0F, 0x04, 0x06, 0x00, 0x04, 0x05, 0x06, 0x04, 0x04, 0x06, 0x00, 0x04, 0x05, 0x07, 0x03, 0x04, 0x06, 0x00, 0x04, 0x0A, 0x03, 0x02, 0x04, 0x06, 0x00, 0x04, 0x03, 0x0A, 0x02, 0x04, 0x06, 0x00, 0x04, 0x02, 0x0B, 0x02, 0x04, 0x08, 0x00, 0x04, 0x01, 0x03, 0x06, 0x03, 0x02, 0x04, 0x08, 0x00, 0x04, 0x01, 0x03, 0x06, 0x03, 0x02, 0x04, 0x08, 0x00, 0x04, 0x01, 0x03, 0x06, 0x03, 0x02, 0x04, 0x08, 0x00, 0x04, 0x01, 0x03, 0x06, 0x03, 0x02, 0x04, 0x04, 0x00, 0x04, 0x02, 0x11, 0x05, 0x00, 0x04, 0x04, 0x0E, 0x01, 0x03, 0x00, 0x04, 0x13, 0x03, 0x00, 0x04, 0x13, 0x03, 0x01, 0x04, 0x12, 0x03, 0x02, 0x0A, 0x0B, 0x03, 0x04, 0x08, 0x0B,  // @
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x42, 0x00, 0x48, 0x00, 0x4E, 0x00, 0x54, 0x00, 0x5A, 0x00, 0x60, 0x00, 0x66, 0x00, 0x6C, 0x00, 0x72, 0x00, 0x76, 0x00, 0x7A, 0x00, 0x7E, 0x00, 0x82, 0x00, 0x88, 0x00, 0x8E, 0x00, 0x93, 0x00, 0x98, 0x00, 0x03, 0x0E, 0x04, 0x0D, 0x03, 0x0D, 0x05, 0x0D, 0x03, 0x0C, 0x07, 0x0C, 0x03, 0x0C, 0x08, 0x0B, 0x05, 0x0B, 0x04, 0x01, 0x04, 0x0B, 0x05, 0x0A, 0x05, 0x02, 0x04, 0x0A, 0x05, 0x0A, 0x04, 0x03, 0x05, 0x09, 0x05, 0x09, 0x04, 0x05, 0x04, 0x09, 0x05, 0x08, 0x05, 0x06, 0x04, 0x08, 0x05, 0x08, 0x04, 0x07, 0x05, 0x07, 0x05, 0x07, 0x04, 0x09, 0x05, 0x06, 0x05, 0x06, 0x05, 0x0A, 0x04, 0x06, 0x05, 0x06, 0x04, 0x0B, 0x05, 0x05, 0x03, 0x05, 0x16, 0x04, 0x03, 0x04, 0x17, 0x04, 0x03, 0x04, 0x18, 0x03, 0x03, 0x03, 0x1A, 0x02, 0x05, 0x02, 0x05, 0x12, 0x04, 0x02, 0x05, 0x02, 0x04, 0x13, 0x05, 0x01, 0x04, 0x01, 0x04, 0x15, 0x05, 0x04, 0x00, 0x04, 0x17, 0x04, 0x05, 0x01, 0x03, 0x18, 0x02, 0x01,  // A
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x41, 0x00, 0x46, 0x00, 0x4B, 0x00, 0x50, 0x00, 0x55, 0x00, 0x59, 0x00, 0x5D, 0x00, 0x61, 0x00, 0x65, 0x00, 0x6A, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x79, 0x00, 0x7E, 0x00, 0x82, 0x00, 0x86, 0x00, 0x8A, 0x00, 0x03, 0x01, 0x16, 0x05, 0x03, 0x00, 0x1A, 0x02, 0x03, 0x00, 0x1B, 0x01, 0x03, 0x00, 0x1B, 0x01, 0x04, 0x00, 0x04, 0x13, 0x05, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x13, 0x05, 0x03, 0x00, 0x1B, 0x01, 0x03, 0x00, 0x1B, 0x01, 0x03, 0x00, 0x1B, 0x01, 0x03, 0x00, 0x1B, 0x01, 0x04, 0x00, 0x04, 0x13, 0x05, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x13, 0x05, 0x03, 0x00, 0x1B, 0x01, 0x03, 0x00, 0x1B, 0x01, 0x03, 0x00, 0x1A, 0x02, 0x03, 0x01, 0x16, 0x05,  // B
+        0x2C, 0x00, 0x30, 0x00, 0x33, 0x00, 0x36, 0x00, 0x3A, 0x00, 0x3E, 0x00, 0x42, 0x00, 0x46, 0x00, 0x4A, 0x00, 0x4E, 0x00, 0x52, 0x00, 0x56, 0x00, 0x5A, 0x00, 0x5E, 0x00, 0x62, 0x00, 0x66, 0x00, 0x6A, 0x00, 0x6E, 0x00, 0x72, 0x00, 0x76, 0x00, 0x79, 0x00, 0x7C, 0x00, 0x03, 0x04, 0x14, 0x01, 0x02, 0x02, 0x17, 0x02, 0x01, 0x18, 0x03, 0x00, 0x18, 0x01, 0x03, 0x00, 0x05, 0x14, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x06, 0x13, 0x03, 0x00, 0x18, 0x01, 0x02, 0x01, 0x18, 0x02, 0x02, 0x17, 0x03, 0x04, 0x14, 0x01,  // C
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3B, 0x00, 0x40, 0x00, 0x45, 0x00, 0x4A, 0x00, 0x4F, 0x00, 0x54, 0x00, 0x59, 0x00, 0x5E, 0x00, 0x63, 0x00, 0x68, 0x00, 0x6D, 0x00, 0x72, 0x00, 0x77, 0x00, 0x7C, 0x00, 0x81, 0x00, 0x85, 0x00, 0x89, 0x00, 0x8D, 0x00, 0x03, 0x01, 0x17, 0x04, 0x03, 0x00, 0x1A, 0x02, 0x03, 0x00, 0x1B, 0x01, 0x02, 0x00, 0x1C, 0x04, 0x00, 0x04, 0x12, 0x06, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x12, 0x06, 0x03, 0x00, 0x1B, 0x01, 0x03, 0x00, 0x1B, 0x01, 0x03, 0x00, 0x19, 0x03, 0x03, 0x01, 0x16, 0x05,  // D
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x40, 0x00, 0x44, 0x00, 0x48, 0x00, 0x4C, 0x00, 0x50, 0x00, 0x54, 0x00, 0x57, 0x00, 0x5A, 0x00, 0x5E, 0x00, 0x62, 0x00, 0x66, 0x00, 0x6A, 0x00, 0x6E, 0x00, 0x72, 0x00, 0x76, 0x00, 0x79, 0x00, 0x7C, 0x00, 0x03, 0x05, 0x09, 0x0B, 0x03, 0x03, 0x0C, 0x0A, 0x03, 0x01, 0x0E, 0x0A, 0x03, 0x01, 0x0D, 0x0B, 0x03, 0x00, 0x05, 0x14, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x18, 0x01, 0x02, 0x00, 0x19, 0x02, 0x00, 0x19, 0x03, 0x00, 0x18, 0x01, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x05, 0x14, 0x03, 0x00, 0x18, 0x01, 0x02, 0x01, 0x18, 0x02, 0x02, 0x17, 0x03, 0x05, 0x13, 0x01,  // E
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x40, 0x00, 0x44, 0x00, 0x48, 0x00, 0x4C, 0x00, 0x50, 0x00, 0x54, 0x00, 0x57, 0x00, 0x5A, 0x00, 0x5E, 0x00, 0x62, 0x00, 0x66, 0x00, 0x6A, 0x00, 0x6E, 0x00, 0x72, 0x00, 0x76, 0x00, 0x7A, 0x00, 0x7E, 0x00, 0x03, 0x05, 0x08, 0x0C, 0x03, 0x03, 0x0B, 0x0B, 0x03, 0x01, 0x0D, 0x0B, 0x03, 0x00, 0x0D, 0x0C, 0x03, 0x00, 0x06, 0x13, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x18, 0x01, 0x02, 0x00, 0x19, 0x02, 0x00, 0x19, 0x03, 0x00, 0x18, 0x01, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x01, 0x02, 0x16,  // F
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x40, 0x00, 0x44, 0x00, 0x48, 0x00, 0x4C, 0x00, 0x50, 0x00, 0x56, 0x00, 0x5B, 0x00, 0x60, 0x00, 0x65, 0x00, 0x6A, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x79, 0x00, 0x7E, 0x00, 0x82, 0x00, 0x86, 0x00, 0x8A, 0x00, 0x03, 0x05, 0x08, 0x0E, 0x03, 0x03, 0x0B, 0x0D, 0x03, 0x01, 0x0D, 0x0D, 0x03, 0x00, 0x0D, 0x0E, 0x03, 0x00, 0x06, 0x15, 0x03, 0x00, 0x04, 0x17, 0x03, 0x00, 0x04, 0x17, 0x03, 0x00, 0x04, 0x17, 0x03, 0x00, 0x04, 0x17, 0x05, 0x00, 0x04, 0x0F, 0x07, 0x01, 0x04, 0x00, 0x04, 0x0E, 0x09, 0x04, 0x00, 0x04, 0x0E, 0x09, 0x04, 0x00, 0x04, 0x0F, 0x08, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x05, 0x10, 0x06, 0x03, 0x00, 0x1A, 0x01, 0x03, 0x01, 0x18, 0x02, 0x03, 0x02, 0x16, 0x03, 0x03, 0x05, 0x11, 0x05,  // G
+        0x2C, 0x00, 0x32, 0x00, 0x37, 0x00, 0x3C, 0x00, 0x41, 0x00, 0x46, 0x00, 0x4B, 0x00, 0x50, 0x00, 0x55, 0x00, 0x5A, 0x00, 0x5D, 0x00, 0x60, 0x00, 0x63, 0x00, 0x66, 0x00, 0x6B, 0x00, 0x70, 0x00, 0x75, 0x00, 0x7A, 0x00, 0x7F, 0x00, 0x84, 0x00, 0x89, 0x00, 0x8E, 0x00, 0x05, 0x01, 0x02, 0x16, 0x02, 0x01, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x02, 0x00, 0x1C, 0x02, 0x00, 0x1C, 0x02, 0x00, 0x1C, 0x02, 0x00, 0x1C, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x05, 0x01, 0x02, 0x16, 0x02, 0x01,  // H
+        0x2C, 0x00, 0x30, 0x00, 0x33, 0x00, 0x36, 0x00, 0x39, 0x00, 0x3C, 0x00, 0x3F, 0x00, 0x42, 0x00, 0x45, 0x00, 0x48, 0x00, 0x4B, 0x00, 0x4E, 0x00, 0x51, 0x00, 0x54, 0x00, 0x57, 0x00, 0x5A, 0x00, 0x5D, 0x00, 0x60, 0x00, 0x63, 0x00, 0x66, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x03, 0x01, 0x02, 0x01, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x03, 0x01, 0x02, 0x01,  // I
+        0x2C, 0x00, 0x30, 0x00, 0x33, 0x00, 0x36, 0x00, 0x39, 0x00, 0x3C, 0x00, 0x3F, 0x00, 0x42, 0x00, 0x45, 0x00, 0x48, 0x00, 0x4B, 0x00, 0x4E, 0x00, 0x51, 0x00, 0x54, 0x00, 0x57, 0x00, 0x5A, 0x00, 0x5D, 0x00, 0x60, 0x00, 0x63, 0x00, 0x67, 0x00, 0x6B, 0x00, 0x6F, 0x00, 0x03, 0x09, 0x02, 0x01, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x06, 0x06, 0x03, 0x01, 0x0A, 0x01, 0x03, 0x00, 0x0B, 0x01, 0x03, 0x00, 0x09, 0x03, 0x03, 0x01, 0x06, 0x05,  // J
+        0x2C, 0x00, 0x32, 0x00, 0x38, 0x00, 0x3E, 0x00, 0x44, 0x00, 0x4A, 0x00, 0x50, 0x00, 0x56, 0x00, 0x5C, 0x00, 0x62, 0x00, 0x66, 0x00, 0x6A, 0x00, 0x6E, 0x00, 0x72, 0x00, 0x78, 0x00, 0x7E, 0x00, 0x84, 0x00, 0x8A, 0x00, 0x90, 0x00, 0x96, 0x00, 0x9C, 0x00, 0xA1, 0x00, 0x05, 0x01, 0x02, 0x10, 0x04, 0x02, 0x05, 0x00, 0x04, 0x0D, 0x07, 0x01, 0x05, 0x00, 0x04, 0x0C, 0x07, 0x02, 0x05, 0x00, 0x04, 0x0A, 0x07, 0x04, 0x05, 0x00, 0x04, 0x08, 0x08, 0x05, 0x05, 0x00, 0x04, 0x06, 0x08, 0x07, 0x05, 0x00, 0x04, 0x04, 0x08, 0x09, 0x05, 0x00, 0x04, 0x02, 0x08, 0x0B, 0x05, 0x00, 0x04, 0x01, 0x07, 0x0D, 0x03, 0x00, 0x0A, 0x0F, 0x03, 0x00, 0x08, 0x11, 0x03, 0x00, 0x09, 0x10, 0x03, 0x00, 0x0B, 0x0E, 0x05, 0x00, 0x04, 0x01, 0x08, 0x0C, 0x05, 0x00, 0x04, 0x03, 0x08, 0x0A, 0x05, 0x00, 0x04, 0x05, 0x07, 0x09, 0x05, 0x00, 0x04, 0x07, 0x07, 0x07, 0x05, 0x00, 0x04, 0x09, 0x07, 0x05, 0x05, 0x00, 0x04, 0x0A, 0x08, 0x03, 0x05, 0x00, 0x04, 0x0C, 0x08, 0x01, 0x04, 0x00, 0x04, 0x0E, 0x07, 0x05, 0x01, 0x02, 0x11, 0x04, 0x01,  // K
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x40, 0x00, 0x44, 0x00, 0x48, 0x00, 0x4C, 0x00, 0x50, 0x00, 0x54, 0x00, 0x58, 0x00, 0x5C, 0x00, 0x60, 0x00, 0x64, 0x00, 0x68, 0x00, 0x6C, 0x00, 0x70, 0x00, 0x74, 0x00, 0x78, 0x00, 0x7B, 0x00, 0x7E, 0x00, 0x03, 0x01, 0x02, 0x16, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x06, 0x13, 0x03, 0x00, 0x18, 0x01, 0x02, 0x01, 0x18, 0x02, 0x02, 0x17, 0x03, 0x05, 0x13, 0x01,  // L
+        0x2C, 0x00, 0x32, 0x00, 0x37, 0x00, 0x3C, 0x00, 0x41, 0x00, 0x46, 0x00, 0x4B, 0x00, 0x50, 0x00, 0x59, 0x00, 0x62, 0x00, 0x6B, 0x00, 0x74, 0x00, 0x7D, 0x00, 0x86, 0x00, 0x8F, 0x00, 0x98, 0x00, 0xA1, 0x00, 0xAA, 0x00, 0xB1, 0x00, 0xB8, 0x00, 0xBF, 0x00, 0xC6, 0x00, 0x05, 0x01, 0x03, 0x1E, 0x03, 0x01, 0x04, 0x00, 0x05, 0x1C, 0x05, 0x04, 0x00, 0x06, 0x1A, 0x06, 0x04, 0x00, 0x07, 0x18, 0x07, 0x04, 0x00, 0x08, 0x16, 0x08, 0x04, 0x00, 0x09, 0x15, 0x08, 0x04, 0x00, 0x09, 0x14, 0x09, 0x08, 0x00, 0x04, 0x01, 0x05, 0x12, 0x05, 0x01, 0x04, 0x08, 0x00, 0x04, 0x02, 0x05, 0x10, 0x05, 0x02, 0x04, 0x08, 0x00, 0x04, 0x03, 0x05, 0x0E, 0x05, 0x03, 0x04, 0x08, 0x00, 0x04, 0x04, 0x05, 0x0C, 0x05, 0x04, 0x04, 0x08, 0x00, 0x04, 0x05, 0x05, 0x0A, 0x06, 0x04, 0x04, 0x08, 0x00, 0x04, 0x05, 0x06, 0x09, 0x05, 0x05, 0x04, 0x08, 0x00, 0x04, 0x06, 0x06, 0x07, 0x05, 0x06, 0x04, 0x08, 0x00, 0x04, 0x07, 0x05, 0x06, 0x05, 0x07, 0x04, 0x08, 0x00, 0x04, 0x08, 0x05, 0x04, 0x05, 0x08, 0x04, 0x08, 0x00, 0x04, 0x09, 0x05, 0x02, 0x05, 0x09, 0x04, 0x06, 0x00, 0x04, 0x0A, 0x0B, 0x09, 0x04, 0x06, 0x00, 0x04, 0x0A, 0x0A, 0x0A, 0x04, 0x06, 0x00, 0x04, 0x0B, 0x08, 0x0B, 0x04, 0x06, 0x00, 0x04, 0x0C, 0x06, 0x0C, 0x04, 0x07, 0x01, 0x02, 0x0E, 0x04, 0x0E, 0x02, 0x01,  // M
+        0x2C, 0x00, 0x32, 0x00, 0x37, 0x00, 0x3C, 0x00, 0x41, 0x00, 0x46, 0x00, 0x4B, 0x00, 0x52, 0x00, 0x59, 0x00, 0x60, 0x00, 0x67, 0x00, 0x6E, 0x00, 0x75, 0x00, 0x7C, 0x00, 0x83, 0x00, 0x8A, 0x00, 0x91, 0x00, 0x96, 0x00, 0x9B, 0x00, 0xA0, 0x00, 0xA5, 0x00, 0xAA, 0x00, 0x05, 0x01, 0x03, 0x15, 0x02, 0x01, 0x04, 0x00, 0x05, 0x13, 0x04, 0x04, 0x00, 0x07, 0x11, 0x04, 0x04, 0x00, 0x08, 0x10, 0x04, 0x04, 0x00, 0x09, 0x0F, 0x04, 0x04, 0x00, 0x0A, 0x0E, 0x04, 0x06, 0x00, 0x04, 0x02, 0x05, 0x0D, 0x04, 0x06, 0x00, 0x04, 0x03, 0x06, 0x0B, 0x04, 0x06, 0x00, 0x04, 0x04, 0x06, 0x0A, 0x04, 0x06, 0x00, 0x04, 0x05, 0x06, 0x09, 0x04, 0x06, 0x00, 0x04, 0x06, 0x06, 0x08, 0x04, 0x06, 0x00, 0x04, 0x08, 0x06, 0x06, 0x04, 0x06, 0x00, 0x04, 0x09, 0x06, 0x05, 0x04, 0x06, 0x00, 0x04, 0x0A, 0x06, 0x04, 0x04, 0x06, 0x00, 0x04, 0x0B, 0x06, 0x03, 0x04, 0x06, 0x00, 0x04, 0x0D, 0x06, 0x01, 0x04, 0x04, 0x00, 0x04, 0x0E, 0x0A, 0x04, 0x00, 0x04, 0x0F, 0x09, 0x04, 0x00, 0x04, 0x10, 0x08, 0x04, 0x00, 0x04, 0x12, 0x06, 0x04, 0x00, 0x04, 0x13, 0x05, 0x05, 0x01, 0x02, 0x15, 0x03, 0x01,  // N
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3B, 0x00, 0x40, 0x00, 0x45, 0x00, 0x4A, 0x00, 0x4F, 0x00, 0x54, 0x00, 0x59, 0x00, 0x5E, 0x00, 0x63, 0x00, 0x68, 0x00, 0x6D, 0x00, 0x72, 0x00, 0x77, 0x00, 0x7C, 0x00, 0x81, 0x00, 0x85, 0x00, 0x89, 0x00, 0x8D, 0x00, 0x03, 0x05, 0x11, 0x05, 0x03, 0x03, 0x16, 0x02, 0x03, 0x01, 0x19, 0x01, 0x02, 0x01, 0x1A, 0x04, 0x00, 0x06, 0x0F, 0x06, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x06, 0x0F, 0x06, 0x03, 0x01, 0x19, 0x01, 0x03, 0x01, 0x19, 0x01, 0x03, 0x03, 0x15, 0x03, 0x03, 0x05, 0x11, 0x05,  // O
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3B, 0x00, 0x40, 0x00, 0x45, 0x00, 0x4A, 0x00, 0x4F, 0x00, 0x54, 0x00, 0x59, 0x00, 0x5E, 0x00, 0x62, 0x00, 0x66, 0x00, 0x6A, 0x00, 0x6E, 0x00, 0x72, 0x00, 0x76, 0x00, 0x7A, 0x00, 0x7E, 0x00, 0x82, 0x00, 0x86, 0x00, 0x03, 0x01, 0x15, 0x05, 0x03, 0x00, 0x19, 0x02, 0x03, 0x00, 0x1A, 0x01, 0x02, 0x00, 0x1B, 0x04, 0x00, 0x04, 0x12, 0x05, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x11, 0x06, 0x03, 0x00, 0x1A, 0x01, 0x03, 0x00, 0x1A, 0x01, 0x03, 0x00, 0x18, 0x03, 0x03, 0x00, 0x16, 0x05, 0x03, 0x00, 0x04, 0x17, 0x03, 0x00, 0x04, 0x17, 0x03, 0x00, 0x04, 0x17, 0x03, 0x00, 0x04, 0x17, 0x03, 0x00, 0x04, 0x17, 0x03, 0x00, 0x04, 0x17, 0x03, 0x01, 0x02, 0x18,  // P
+        0x32, 0x00, 0x36, 0x00, 0x3A, 0x00, 0x3E, 0x00, 0x41, 0x00, 0x46, 0x00, 0x4B, 0x00, 0x50, 0x00, 0x55, 0x00, 0x5A, 0x00, 0x5F, 0x00, 0x64, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x78, 0x00, 0x7D, 0x00, 0x82, 0x00, 0x87, 0x00, 0x8B, 0x00, 0x8F, 0x00, 0x93, 0x00, 0x97, 0x00, 0x9B, 0x00, 0x9F, 0x00, 0x03, 0x05, 0x13, 0x04, 0x03, 0x02, 0x18, 0x02, 0x03, 0x01, 0x1A, 0x01, 0x02, 0x00, 0x1C, 0x04, 0x00, 0x06, 0x10, 0x06, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x05, 0x11, 0x06, 0x03, 0x01, 0x1A, 0x01, 0x03, 0x01, 0x1A, 0x01, 0x03, 0x03, 0x16, 0x03, 0x03, 0x05, 0x14, 0x03, 0x03, 0x14, 0x06, 0x02, 0x03, 0x15, 0x06, 0x01, 0x03, 0x17, 0x03, 0x02,  // Q
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3B, 0x00, 0x40, 0x00, 0x45, 0x00, 0x4A, 0x00, 0x4F, 0x00, 0x54, 0x00, 0x59, 0x00, 0x5C, 0x00, 0x60, 0x00, 0x64, 0x00, 0x68, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x7A, 0x00, 0x80, 0x00, 0x86, 0x00, 0x8C, 0x00, 0x92, 0x00, 0x03, 0x00, 0x16, 0x05, 0x03, 0x00, 0x19, 0x02, 0x03, 0x00, 0x1A, 0x01, 0x02, 0x00, 0x1B, 0x04, 0x00, 0x04, 0x12, 0x05, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x13, 0x04, 0x04, 0x00, 0x04, 0x12, 0x05, 0x02, 0x00, 0x1B, 0x03, 0x00, 0x1A, 0x01, 0x03, 0x00, 0x19, 0x02, 0x03, 0x00, 0x16, 0x05, 0x05, 0x00, 0x04, 0x01, 0x08, 0x0E, 0x05, 0x00, 0x04, 0x03, 0x08, 0x0C, 0x05, 0x00, 0x04, 0x06, 0x08, 0x09, 0x05, 0x00, 0x04, 0x08, 0x08, 0x07, 0x05, 0x00, 0x04, 0x0A, 0x09, 0x04, 0x05, 0x00, 0x04, 0x0D, 0x08, 0x02, 0x05, 0x00, 0x04, 0x0F, 0x07, 0x01, 0x05, 0x01, 0x02, 0x12, 0x04, 0x02,  // R
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x40, 0x00, 0x44, 0x00, 0x48, 0x00, 0x4C, 0x00, 0x50, 0x00, 0x54, 0x00, 0x58, 0x00, 0x5C, 0x00, 0x5F, 0x00, 0x62, 0x00, 0x65, 0x00, 0x68, 0x00, 0x6B, 0x00, 0x6E, 0x00, 0x71, 0x00, 0x75, 0x00, 0x79, 0x00, 0x03, 0x04, 0x08, 0x0C, 0x03, 0x02, 0x0B, 0x0B, 0x03, 0x01, 0x0C, 0x0B, 0x03, 0x00, 0x0C, 0x0C, 0x03, 0x00, 0x05, 0x13, 0x03, 0x00, 0x04, 0x14, 0x03, 0x00, 0x04, 0x14, 0x03, 0x00, 0x05, 0x13, 0x03, 0x00, 0x13, 0x05, 0x03, 0x01, 0x14, 0x03, 0x03, 0x02, 0x15, 0x01, 0x03, 0x03, 0x14, 0x01, 0x02, 0x12, 0x06, 0x02, 0x14, 0x04, 0x02, 0x14, 0x04, 0x02, 0x14, 0x04, 0x02, 0x14, 0x04, 0x02, 0x13, 0x05, 0x02, 0x01, 0x17, 0x03, 0x00, 0x17, 0x01, 0x03, 0x00, 0x16, 0x02, 0x03, 0x01, 0x13, 0x04,  // S
+        0x2C, 0x00, 0x30, 0x00, 0x33, 0x00, 0x36, 0x00, 0x3A, 0x00, 0x3E, 0x00, 0x42, 0x00, 0x46, 0x00, 0x4A, 0x00, 0x4E, 0x00, 0x52, 0x00, 0x56, 0x00, 0x5A, 0x00, 0x5E, 0x00, 0x62, 0x00, 0x66, 0x00, 0x6A, 0x00, 0x6E, 0x00, 0x72, 0x00, 0x76, 0x00, 0x7A, 0x00, 0x7E, 0x00, 0x03, 0x01, 0x16, 0x01, 0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x03, 0x01, 0x16, 0x01, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x0B, 0x02, 0x0B,  // T
+        0x2C, 0x00, 0x32, 0x00, 0x37, 0x00, 0x3C, 0x00, 0x41, 0x00, 0x46, 0x00, 0x4B, 0x00, 0x50, 0x00, 0x55, 0x00, 0x5A, 0x00, 0x5F, 0x00, 0x64, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x78, 0x00, 0x7D, 0x00, 0x82, 0x00, 0x87, 0x00, 0x8B, 0x00, 0x8F, 0x00, 0x93, 0x00, 0x05, 0x01, 0x02, 0x16, 0x02, 0x01, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x04, 0x14, 0x04, 0x04, 0x00, 0x05, 0x12, 0x05, 0x04, 0x00, 0x06, 0x10, 0x06, 0x03, 0x00, 0x1B, 0x01, 0x03, 0x01, 0x19, 0x02, 0x03, 0x02, 0x17, 0x03, 0x03, 0x05, 0x11, 0x06,  // U
+        0x2C, 0x00, 0x32, 0x00, 0x37, 0x00, 0x3D, 0x00, 0x43, 0x00, 0x49, 0x00, 0x4F, 0x00, 0x55, 0x00, 0x5B, 0x00, 0x61, 0x00, 0x67, 0x00, 0x6D, 0x00, 0x73, 0x00, 0x79, 0x00, 0x7F, 0x00, 0x85, 0x00, 0x8B, 0x00, 0x91, 0x00, 0x95, 0x00, 0x99, 0x00, 0x9D, 0x00, 0xA1, 0x00, 0x05, 0x01, 0x03, 0x18, 0x03, 0x01, 0x04, 0x00, 0x05, 0x16, 0x05, 0x05, 0x01, 0x04, 0x16, 0x04, 0x01, 0x05, 0x02, 0x04, 0x14, 0x05, 0x01, 0x05, 0x02, 0x05, 0x12, 0x05, 0x02, 0x05, 0x03, 0x05, 0x11, 0x04, 0x03, 0x05, 0x04, 0x04, 0x10, 0x04, 0x04, 0x05, 0x04, 0x05, 0x0E, 0x05, 0x04, 0x05, 0x05, 0x05, 0x0C, 0x05, 0x05, 0x05, 0x06, 0x04, 0x0C, 0x04, 0x06, 0x05, 0x06, 0x05, 0x0A, 0x05, 0x06, 0x05, 0x07, 0x05, 0x08, 0x05, 0x07, 0x05, 0x08, 0x04, 0x08, 0x04, 0x08, 0x05, 0x09, 0x04, 0x06, 0x05, 0x08, 0x05, 0x09, 0x05, 0x04, 0x05, 0x09, 0x05, 0x0A, 0x05, 0x03, 0x04, 0x0A, 0x05, 0x0B, 0x04, 0x02, 0x04, 0x0B, 0x03, 0x0B, 0x0A, 0x0B, 0x03, 0x0C, 0x08, 0x0C, 0x03, 0x0D, 0x06, 0x0D, 0x03, 0x0E, 0x05, 0x0D, 0x03, 0x0E, 0x04, 0x0E,  // V
+        0x2C, 0x00, 0x34, 0x00, 0x3B, 0x00, 0x42, 0x00, 0x4A, 0x00, 0x52, 0x00, 0x5A, 0x00, 0x64, 0x00, 0x6E, 0x00, 0x78, 0x00, 0x82, 0x00, 0x8C, 0x00, 0x96, 0x00, 0xA0, 0x00, 0xAA, 0x00, 0xB4, 0x00, 0xBE, 0x00, 0xC4, 0x00, 0xCA, 0x00, 0xD0, 0x00, 0xD6, 0x00, 0xDC, 0x00, 0x07, 0x01, 0x03, 0x10, 0x03, 0x10, 0x02, 0x01, 0x06, 0x00, 0x05, 0x0E, 0x04, 0x0F, 0x04, 0x06, 0x01, 0x04, 0x0D, 0x06, 0x0D, 0x05, 0x07, 0x01, 0x05, 0x0C, 0x06, 0x0D, 0x04, 0x01, 0x07, 0x02, 0x04, 0x0B, 0x08, 0x0B, 0x05, 0x01, 0x07, 0x02, 0x04, 0x0B, 0x08, 0x0B, 0x04, 0x02, 0x09, 0x03, 0x04, 0x09, 0x05, 0x01, 0x04, 0x09, 0x05, 0x02, 0x09, 0x03, 0x04, 0x09, 0x04, 0x02, 0x04, 0x09, 0x04, 0x03, 0x09, 0x04, 0x04, 0x08, 0x04, 0x03, 0x04, 0x07, 0x05, 0x03, 0x09, 0x04, 0x04, 0x07, 0x04, 0x04, 0x04, 0x07, 0x04, 0x04, 0x09, 0x05, 0x04, 0x06, 0x04, 0x04, 0x05, 0x05, 0x05, 0x04, 0x09, 0x05, 0x04, 0x05, 0x04, 0x06, 0x04, 0x05, 0x04, 0x05, 0x09, 0x05, 0x05, 0x04, 0x04, 0x06, 0x05, 0x04, 0x04, 0x05, 0x09, 0x06, 0x04, 0x03, 0x05, 0x07, 0x04, 0x03, 0x04, 0x06, 0x09, 0x06, 0x05, 0x02, 0x04, 0x08, 0x05, 0x02, 0x04, 0x06, 0x09, 0x07, 0x04, 0x01, 0x05, 0x09, 0x04, 0x01, 0x04, 0x07, 0x05, 0x07, 0x09, 0x0A, 0x09, 0x07, 0x05, 0x08, 0x08, 0x0B, 0x07, 0x08, 0x05, 0x08, 0x07, 0x0C, 0x07, 0x08, 0x05, 0x09, 0x06, 0x0D, 0x05, 0x09, 0x05, 0x09, 0x05, 0x0E, 0x05, 0x09, 0x05, 0x0A, 0x03, 0x10, 0x03, 0x0A,  // W
+        0x2C, 0x00, 0x32, 0x00, 0x37, 0x00, 0x3D, 0x00, 0x43, 0x00, 0x49, 0x00, 0x4F, 0x00, 0x55, 0x00, 0x5B, 0x00, 0x5F, 0x00, 0x63, 0x00, 0x67, 0x00, 0x6B, 0x00, 0x6F, 0x00, 0x75, 0x00, 0x7B, 0x00, 0x81, 0x00, 0x87, 0x00, 0x8D, 0x00, 0x93, 0x00, 0x99, 0x00, 0x9E, 0x00, 0x05, 0x02, 0x03, 0x13, 0x03, 0x01, 0x04, 0x01, 0x05, 0x11, 0x05, 0x05, 0x02, 0x05, 0x0E, 0x06, 0x01, 0x05, 0x03, 0x05, 0x0C, 0x06, 0x02, 0x05, 0x04, 0x05, 0x0A, 0x06, 0x03, 0x05, 0x05, 0x06, 0x07, 0x05, 0x05, 0x05, 0x06, 0x06, 0x05, 0x05, 0x06, 0x05, 0x07, 0x06, 0x02, 0x06, 0x07, 0x03, 0x09, 0x0B, 0x08, 0x03, 0x0A, 0x09, 0x09, 0x03, 0x0B, 0x07, 0x0A, 0x03, 0x0B, 0x07, 0x0A, 0x03, 0x09, 0x0A, 0x09, 0x05, 0x08, 0x06, 0x01, 0x05, 0x08, 0x05, 0x07, 0x06, 0x03, 0x05, 0x07, 0x05, 0x06, 0x06, 0x05, 0x05, 0x06, 0x05, 0x05, 0x05, 0x08, 0x06, 0x04, 0x05, 0x03, 0x06, 0x0A, 0x06, 0x03, 0x05, 0x02, 0x06, 0x0D, 0x05, 0x02, 0x05, 0x01, 0x06, 0x0F, 0x05, 0x01, 0x04, 0x00, 0x06, 0x11, 0x05, 0x04, 0x01, 0x03, 0x14, 0x04,  // X
+        0x2C, 0x00, 0x32, 0x00, 0x37, 0x00, 0x3D, 0x00, 0x43, 0x00, 0x49, 0x00, 0x4F, 0x00, 0x55, 0x00, 0x5B, 0x00, 0x61, 0x00, 0x65, 0x00, 0x69, 0x00, 0x6D, 0x00, 0x71, 0x00, 0x75, 0x00, 0x79, 0x00, 0x7D, 0x00, 0x81, 0x00, 0x85, 0x00, 0x89, 0x00, 0x8D, 0x00, 0x91, 0x00, 0x05, 0x01, 0x02, 0x14, 0x03, 0x01, 0x04, 0x00, 0x05, 0x10, 0x06, 0x05, 0x00, 0x06, 0x0E, 0x06, 0x01, 0x05, 0x01, 0x06, 0x0C, 0x06, 0x02, 0x05, 0x02, 0x06, 0x0A, 0x06, 0x03, 0x05, 0x03, 0x06, 0x08, 0x06, 0x04, 0x05, 0x04, 0x06, 0x06, 0x06, 0x05, 0x05, 0x05, 0x06, 0x04, 0x06, 0x06, 0x05, 0x06, 0x06, 0x02, 0x06, 0x07, 0x03, 0x08, 0x0B, 0x08, 0x03, 0x09, 0x08, 0x0A, 0x03, 0x0A, 0x06, 0x0B, 0x03, 0x0B, 0x04, 0x0C, 0x03, 0x0B, 0x04, 0x0C, 0x03, 0x0B, 0x04, 0x0C, 0x03, 0x0B, 0x04, 0x0C, 0x03, 0x0B, 0x04, 0x0C, 0x03, 0x0B, 0x04, 0x0C, 0x03, 0x0B, 0x04, 0x0C, 0x03, 0x0B, 0x04, 0x0C, 0x03, 0x0B, 0x04, 0x0C, 0x03, 0x0C, 0x02, 0x0D,  // Y
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x40, 0x00, 0x44, 0x00, 0x48, 0x00, 0x4C, 0x00, 0x50, 0x00, 0x54, 0x00, 0x58, 0x00, 0x5C, 0x00, 0x60, 0x00, 0x64, 0x00, 0x68, 0x00, 0x6C, 0x00, 0x70, 0x00, 0x74, 0x00, 0x78, 0x00, 0x7B, 0x00, 0x7E, 0x00, 0x03, 0x09, 0x0E, 0x02, 0x03, 0x08, 0x10, 0x01, 0x03, 0x08, 0x10, 0x01, 0x03, 0x09, 0x0E, 0x02, 0x03, 0x10, 0x06, 0x03, 0x03, 0x0F, 0x06, 0x04, 0x03, 0x0E, 0x06, 0x05, 0x03, 0x0D, 0x05, 0x07, 0x03, 0x0C, 0x05, 0x08, 0x03, 0x0B, 0x05, 0x09, 0x03, 0x09, 0x06, 0x0A, 0x03, 0x08, 0x05, 0x0C, 0x03, 0x07, 0x05, 0x0D, 0x03, 0x06, 0x05, 0x0E, 0x03, 0x05, 0x05, 0x0F, 0x03, 0x04, 0x05, 0x10, 0x03, 0x02, 0x05, 0x12, 0x03, 0x01, 0x05, 0x13, 0x03, 0x00, 0x18, 0x01, 0x02, 0x00, 0x19, 0x02, 0x00, 0x19, 0x03, 0x01, 0x17, 0x01,  // Z
+        0x2C, 0x00, 0x30, 0x00, 0x33, 0x00, 0x36, 0x00, 0x3A, 0x00, 0x3E, 0x00, 0x42, 0x00, 0x46, 0x00, 0x4A, 0x00, 0x4E, 0x00, 0x52, 0x00, 0x56, 0x00, 0x5A, 0x00, 0x5E, 0x00, 0x62, 0x00, 0x66, 0x00, 0x6A, 0x00, 0x6E, 0x00, 0x72, 0x00, 0x76, 0x00, 0x79, 0x00, 0x7C, 0x00, 0x03, 0x01, 0x06, 0x01, 0x02, 0x00, 0x08, 0x02, 0x00, 0x08, 0x03, 0x00, 0x07, 0x01, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x07, 0x01, 0x02, 0x00, 0x08, 0x02, 0x00, 0x08, 0x03, 0x01, 0x06, 0x01,  // [
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x40, 0x00, 0x44, 0x00, 0x48, 0x00, 0x4C, 0x00, 0x50, 0x00, 0x54, 0x00, 0x58, 0x00, 0x5C, 0x00, 0x60, 0x00, 0x64, 0x00, 0x68, 0x00, 0x6C, 0x00, 0x70, 0x00, 0x74, 0x00, 0x78, 0x00, 0x7B, 0x00, 0x7E, 0x00, 0x03, 0x01, 0x03, 0x14, 0x03, 0x00, 0x05, 0x13, 0x03, 0x01, 0x05, 0x12, 0x03, 0x02, 0x05, 0x11, 0x03, 0x03, 0x05, 0x10, 0x03, 0x04, 0x06, 0x0E, 0x03, 0x05, 0x06, 0x0D, 0x03, 0x06, 0x06, 0x0C, 0x03, 0x07, 0x06, 0x0B, 0x03, 0x08, 0x06, 0x0A, 0x03, 0x09, 0x06, 0x09, 0x03, 0x0A, 0x06, 0x08, 0x03, 0x0B, 0x06, 0x07, 0x03, 0x0C, 0x06, 0x06, 0x03, 0x0E, 0x05, 0x05, 0x03, 0x0F, 0x05, 0x04, 0x03, 0x10, 0x05, 0x03, 0x03, 0x11, 0x05, 0x02, 0x03, 0x12, 0x05, 0x01, 0x02, 0x13, 0x05, 0x02, 0x14, 0x04, 0x03, 0x15, 0x02, 0x01,  // backslash
+        0x2C, 0x00, 0x30, 0x00, 0x33, 0x00, 0x36, 0x00, 0x39, 0x00, 0x3C, 0x00, 0x3F, 0x00, 0x42, 0x00, 0x45, 0x00, 0x48, 0x00, 0x4B, 0x00, 0x4E, 0x00, 0x51, 0x00, 0x54, 0x00, 0x57, 0x00, 0x5A, 0x00, 0x5D, 0x00, 0x60, 0x00, 0x63, 0x00, 0x66, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x03, 0x01, 0x06, 0x01, 0x02, 0x00, 0x08, 0x02, 0x00, 0x08, 0x02, 0x01, 0x07, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x01, 0x07, 0x02, 0x00, 0x08, 0x02, 0x00, 0x08, 0x03, 0x01, 0x06, 0x01,  // ]
+        0x0E, 0x00, 0x12, 0x00, 0x16, 0x00, 0x1A, 0x00, 0x20, 0x00, 0x26, 0x00, 0x2B, 0x00, 0x03, 0x05, 0x02, 0x05, 0x03, 0x04, 0x04, 0x04, 0x03, 0x03, 0x06, 0x03, 0x05, 0x02, 0x03, 0x02, 0x03, 0x02, 0x05, 0x01, 0x03, 0x04, 0x03, 0x01, 0x04, 0x00, 0x03, 0x06, 0x03, 0x04, 0x00, 0x02, 0x08, 0x02,  // ^
+        0x08, 0x00, 0x0C, 0x00, 0x0F, 0x00, 0x12, 0x00, 0x03, 0x01, 0x19, 0x01, 0x02, 0x00, 0x1B, 0x02, 0x00, 0x1B, 0x03, 0x01, 0x19, 0x01,  // _
+        0x0E, 0x00, 0x12, 0x00, 0x16, 0x00, 0x1A, 0x00, 0x1E, 0x00, 0x22, 0x00, 0x25, 0x00, 0x03, 0x00, 0x02, 0x05, 0x03, 0x00, 0x03, 0x04, 0x03, 0x01, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x03, 0x01, 0x02, 0x04, 0x03, 0x02, 0x05, 0x02,  // `
+        0x24, 0x00, 0x28, 0x00, 0x2C, 0x00, 0x30, 0x00, 0x33, 0x00, 0x36, 0x00, 0x39, 0x00, 0x3C, 0x00, 0x3F, 0x00, 0x42, 0x00, 0x47, 0x00, 0x4C, 0x00, 0x51, 0x00, 0x56, 0x00, 0x5B, 0x00, 0x5E, 0x00, 0x62, 0x00, 0x66, 0x00, 0x03, 0x0E, 0x07, 0x05, 0x03, 0x0D, 0x0B, 0x02, 0x03, 0x0D, 0x0C, 0x01, 0x02, 0x0E, 0x0C, 0x02, 0x15, 0x05, 0x02, 0x04, 0x16, 0x02, 0x02, 0x18, 0x02, 0x01, 0x19, 0x02, 0x00, 0x1A, 0x04, 0x00, 0x05, 0x11, 0x04, 0x04, 0x00, 0x04, 0x12, 0x04, 0x04, 0x00, 0x04, 0x12, 0x04, 0x04, 0x00, 0x04, 0x12, 0x04, 0x04, 0x00, 0x05, 0x10, 0x05, 0x02, 0x00, 0x1A, 0x03, 0x01, 0x18, 0x01, 0x03, 0x02, 0x16, 0x02, 0x03, 0x05, 0x11, 0x04,  // a
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x40, 0x00, 0x44, 0x00, 0x48, 0x00, 0x4C, 0x00, 0x4F, 0x00, 0x54, 0x00, 0x59, 0x00, 0x5E, 0x00, 0x63, 0x00, 0x68, 0x00, 0x6D, 0x00, 0x72, 0x00, 0x77, 0x00, 0x7C, 0x00, 0x7F, 0x00, 0x83, 0x00, 0x87, 0x00, 0x03, 0x01, 0x02, 0x15, 0x03, 0x00, 0x04, 0x14, 0x03, 0x00, 0x04, 0x14, 0x03, 0x00, 0x04, 0x14, 0x03, 0x00, 0x04, 0x14, 0x03, 0x00, 0x14, 0x04, 0x03, 0x00, 0x16, 0x02, 0x03, 0x00, 0x17, 0x01, 0x02, 0x00, 0x18, 0x04, 0x00, 0x04, 0x0F, 0x05, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x06, 0x0D, 0x05, 0x02, 0x00, 0x18, 0x03, 0x01, 0x16, 0x01, 0x03, 0x03, 0x13, 0x02, 0x03, 0x05, 0x0F, 0x04,  // b
+        0x24, 0x00, 0x28, 0x00, 0x2B, 0x00, 0x2E, 0x00, 0x32, 0x00, 0x36, 0x00, 0x3A, 0x00, 0x3E, 0x00, 0x42, 0x00, 0x46, 0x00, 0x4A, 0x00, 0x4E, 0x00, 0x52, 0x00, 0x56, 0x00, 0x5A, 0x00, 0x5E, 0x00, 0x61, 0x00, 0x64, 0x00, 0x03, 0x04, 0x14, 0x01, 0x02, 0x02, 0x17, 0x02, 0x01, 0x18, 0x03, 0x00, 0x18, 0x01, 0x03, 0x00, 0x05, 0x14, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x04, 0x15, 0x03, 0x00, 0x05, 0x14, 0x03, 0x00, 0x18, 0x01, 0x02, 0x01, 0x18, 0x02, 0x02, 0x17, 0x03, 0x04, 0x14, 0x01,  // c
+        0x2C, 0x00, 0x30, 0x00, 0x33, 0x00, 0x36, 0x00, 0x39, 0x00, 0x3C, 0x00, 0x3F, 0x00, 0x42, 0x00, 0x45, 0x00, 0x48, 0x00, 0x4D, 0x00, 0x52, 0x00, 0x57, 0x00, 0x5C, 0x00, 0x61, 0x00, 0x66, 0x00, 0x6B, 0x00, 0x70, 0x00, 0x75, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x80, 0x00, 0x03, 0x15, 0x02, 0x01, 0x02, 0x14, 0x04, 0x02, 0x14, 0x04, 0x02, 0x14, 0x04, 0x02, 0x14, 0x04, 0x02, 0x04, 0x14, 0x02, 0x02, 0x16, 0x02, 0x01, 0x17, 0x02, 0x00, 0x18, 0x04, 0x00, 0x05, 0x0F, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x00, 0x18, 0x03, 0x01, 0x16, 0x01, 0x03, 0x02, 0x13, 0x03, 0x03, 0x04, 0x0F, 0x05,  // d
+        0x24, 0x00, 0x28, 0x00, 0x2C, 0x00, 0x30, 0x00, 0x33, 0x00, 0x38, 0x00, 0x3D, 0x00, 0x42, 0x00, 0x47, 0x00, 0x4A, 0x00, 0x4D, 0x00, 0x50, 0x00, 0x53, 0x00, 0x57, 0x00, 0x5B, 0x00, 0x5F, 0x00, 0x63, 0x00, 0x67, 0x00, 0x03, 0x05, 0x0E, 0x04, 0x03, 0x02, 0x13, 0x02, 0x03, 0x01, 0x15, 0x01, 0x02, 0x00, 0x17, 0x04, 0x00, 0x05, 0x0C, 0x06, 0x04, 0x00, 0x04, 0x0F, 0x04, 0x04, 0x00, 0x04, 0x0F, 0x04, 0x04, 0x00, 0x04, 0x0F, 0x04, 0x02, 0x00, 0x17, 0x02, 0x00, 0x17, 0x02, 0x00, 0x17, 0x02, 0x00, 0x17, 0x03, 0x00, 0x04, 0x13, 0x03, 0x00, 0x05, 0x12, 0x03, 0x00, 0x0C, 0x0B, 0x03, 0x01, 0x0C, 0x0A, 0x03, 0x02, 0x0B, 0x0A, 0x03, 0x04, 0x08, 0x0B,  // e
+        0x2C, 0x00, 0x30, 0x00, 0x33, 0x00, 0x36, 0x00, 0x3A, 0x00, 0x3E, 0x00, 0x42, 0x00, 0x45, 0x00, 0x48, 0x00, 0x4C, 0x00, 0x50, 0x00, 0x54, 0x00, 0x58, 0x00, 0x5C, 0x00, 0x60, 0x00, 0x64, 0x00, 0x68, 0x00, 0x6C, 0x00, 0x70, 0x00, 0x74, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x03, 0x04, 0x06, 0x01, 0x02, 0x02, 0x09, 0x02, 0x01, 0x0A, 0x03, 0x00, 0x0A, 0x01, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x0A, 0x01, 0x02, 0x00, 0x0B, 0x02, 0x00, 0x0B, 0x03, 0x00, 0x0A, 0x01, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x01, 0x02, 0x08,  // f
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3B, 0x00, 0x40, 0x00, 0x45, 0x00, 0x4A, 0x00, 0x4F, 0x00, 0x54, 0x00, 0x59, 0x00, 0x5E, 0x00, 0x63, 0x00, 0x68, 0x00, 0x6B, 0x00, 0x6E, 0x00, 0x71, 0x00, 0x74, 0x00, 0x77, 0x00, 0x7A, 0x00, 0x7E, 0x00, 0x82, 0x00, 0x03, 0x05, 0x0D, 0x06, 0x03, 0x02, 0x13, 0x03, 0x03, 0x01, 0x16, 0x01, 0x02, 0x00, 0x18, 0x04, 0x00, 0x05, 0x0D, 0x06, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x05, 0x0F, 0x04, 0x02, 0x00, 0x18, 0x02, 0x01, 0x17, 0x02, 0x02, 0x16, 0x02, 0x05, 0x13, 0x02, 0x13, 0x05, 0x02, 0x0C, 0x0C, 0x03, 0x0B, 0x0C, 0x01, 0x03, 0x0B, 0x0A, 0x03, 0x03, 0x0C, 0x07, 0x05,  // g
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x40, 0x00, 0x44, 0x00, 0x48, 0x00, 0x4C, 0x00, 0x4F, 0x00, 0x54, 0x00, 0x59, 0x00, 0x5E, 0x00, 0x63, 0x00, 0x68, 0x00, 0x6D, 0x00, 0x72, 0x00, 0x77, 0x00, 0x7C, 0x00, 0x81, 0x00, 0x86, 0x00, 0x8B, 0x00, 0x03, 0x01, 0x02, 0x15, 0x03, 0x00, 0x04, 0x14, 0x03, 0x00, 0x04, 0x14, 0x03, 0x00, 0x04, 0x14, 0x03, 0x00, 0x04, 0x14, 0x03, 0x00, 0x14, 0x04, 0x03, 0x00, 0x16, 0x02, 0x03, 0x00, 0x17, 0x01, 0x02, 0x00, 0x18, 0x04, 0x00, 0x04, 0x0F, 0x05, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x05, 0x01, 0x02, 0x12, 0x02, 0x01,  // h
+        0x2C, 0x00, 0x30, 0x00, 0x33, 0x00, 0x36, 0x00, 0x3A, 0x00, 0x3C, 0x00, 0x40, 0x00, 0x43, 0x00, 0x46, 0x00, 0x49, 0x00, 0x4C, 0x00, 0x4F, 0x00, 0x52, 0x00, 0x55, 0x00, 0x58, 0x00, 0x5B, 0x00, 0x5E, 0x00, 0x61, 0x00, 0x64, 0x00, 0x67, 0x00, 0x6A, 0x00, 0x6D, 0x00, 0x03, 0x01, 0x03, 0x01, 0x02, 0x00, 0x05, 0x02, 0x00, 0x05, 0x03, 0x01, 0x03, 0x01, 0x01, 0x05, 0x03, 0x02, 0x02, 0x01, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x03, 0x02, 0x02, 0x01,  // i
+        0x34, 0x00, 0x38, 0x00, 0x3B, 0x00, 0x3E, 0x00, 0x42, 0x00, 0x44, 0x00, 0x48, 0x00, 0x4B, 0x00, 0x4E, 0x00, 0x51, 0x00, 0x54, 0x00, 0x57, 0x00, 0x5A, 0x00, 0x5D, 0x00, 0x60, 0x00, 0x63, 0x00, 0x66, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x6F, 0x00, 0x72, 0x00, 0x75, 0x00, 0x78, 0x00, 0x7B, 0x00, 0x7F, 0x00, 0x83, 0x00, 0x03, 0x08, 0x03, 0x01, 0x02, 0x07, 0x05, 0x02, 0x07, 0x05, 0x03, 0x08, 0x03, 0x01, 0x01, 0x0C, 0x03, 0x09, 0x02, 0x01, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x08, 0x04, 0x02, 0x07, 0x05, 0x02, 0x01, 0x0B, 0x03, 0x00, 0x0B, 0x01, 0x03, 0x00, 0x0A, 0x02, 0x03, 0x01, 0x07, 0x04,  // j
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x40, 0x00, 0x46, 0x00, 0x4B, 0x00, 0x51, 0x00, 0x57, 0x00, 0x5D, 0x00, 0x63, 0x00, 0x67, 0x00, 0x6B, 0x00, 0x6F, 0x00, 0x73, 0x00, 0x77, 0x00, 0x7D, 0x00, 0x83, 0x00, 0x89, 0x00, 0x8E, 0x00, 0x93, 0x00, 0x03, 0x01, 0x02, 0x11, 0x03, 0x00, 0x04, 0x10, 0x03, 0x00, 0x04, 0x10, 0x03, 0x00, 0x04, 0x10, 0x03, 0x00, 0x04, 0x10, 0x05, 0x00, 0x04, 0x0C, 0x03, 0x01, 0x04, 0x00, 0x04, 0x0A, 0x06, 0x05, 0x00, 0x04, 0x08, 0x07, 0x01, 0x05, 0x00, 0x04, 0x06, 0x07, 0x03, 0x05, 0x00, 0x04, 0x04, 0x07, 0x05, 0x05, 0x00, 0x04, 0x02, 0x07, 0x07, 0x03, 0x00, 0x0B, 0x09, 0x03, 0x00, 0x09, 0x0B, 0x03, 0x00, 0x08, 0x0C, 0x03, 0x00, 0x0A, 0x0A, 0x03, 0x00, 0x0C, 0x08, 0x05, 0x00, 0x04, 0x02, 0x08, 0x06, 0x05, 0x00, 0x04, 0x04, 0x08, 0x04, 0x05, 0x00, 0x04, 0x06, 0x08, 0x02, 0x04, 0x00, 0x04, 0x08, 0x08, 0x04, 0x00, 0x04, 0x0A, 0x06, 0x05, 0x01, 0x02, 0x0D, 0x03, 0x01,  // k
+        0x2C, 0x00, 0x30, 0x00, 0x33, 0x00, 0x36, 0x00, 0x39, 0x00, 0x3C, 0x00, 0x3F, 0x00, 0x42, 0x00, 0x45, 0x00, 0x48, 0x00, 0x4B, 0x00, 0x4E, 0x00, 0x51, 0x00, 0x54, 0x00, 0x57, 0x00, 0x5A, 0x00, 0x5D, 0x00, 0x60, 0x00, 0x63, 0x00, 0x66, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x03, 0x01, 0x02, 0x01, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x03, 0x01, 0x02, 0x01,  // l
+        0x24, 0x00, 0x2A, 0x00, 0x2E, 0x00, 0x32, 0x00, 0x35, 0x00, 0x3C, 0x00, 0x43, 0x00, 0x4A, 0x00, 0x51, 0x00, 0x58, 0x00, 0x5F, 0x00, 0x66, 0x00, 0x6D, 0x00, 0x74, 0x00, 0x7B, 0x00, 0x82, 0x00, 0x89, 0x00, 0x90, 0x00, 0x05, 0x04, 0x0B, 0x03, 0x0B, 0x04, 0x03, 0x02, 0x1D, 0x02, 0x03, 0x01, 0x1F, 0x01, 0x02, 0x00, 0x21, 0x06, 0x00, 0x05, 0x09, 0x06, 0x08, 0x05, 0x06, 0x00, 0x04, 0x0B, 0x04, 0x0A, 0x04, 0x06, 0x00, 0x04, 0x0B, 0x04, 0x0A, 0x04, 0x06, 0x00, 0x04, 0x0B, 0x04, 0x0A, 0x04, 0x06, 0x00, 0x04, 0x0B, 0x04, 0x0A, 0x04, 0x06, 0x00, 0x04, 0x0B, 0x04, 0x0A, 0x04, 0x06, 0x00, 0x04, 0x0B, 0x04, 0x0A, 0x04, 0x06, 0x00, 0x04, 0x0B, 0x04, 0x0A, 0x04, 0x06, 0x00, 0x04, 0x0B, 0x04, 0x0A, 0x04, 0x06, 0x00, 0x04, 0x0B, 0x04, 0x0A, 0x04, 0x06, 0x00, 0x04, 0x0B, 0x04, 0x0A, 0x04, 0x06, 0x00, 0x04, 0x0B, 0x04, 0x0A, 0x04, 0x06, 0x00, 0x04, 0x0B, 0x04, 0x0A, 0x04, 0x07, 0x01, 0x02, 0x0D, 0x02, 0x0C, 0x02, 0x01,  // m
+        0x24, 0x00, 0x28, 0x00, 0x2C, 0x00, 0x30, 0x00, 0x33, 0x00, 0x38, 0x00, 0x3D, 0x00, 0x42, 0x00, 0x47, 0x00, 0x4C, 0x00, 0x51, 0x00, 0x56, 0x00, 0x5B, 0x00, 0x60, 0x00, 0x65, 0x00, 0x6A, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x03, 0x04, 0x10, 0x04, 0x03, 0x02, 0x14, 0x02, 0x03, 0x01, 0x16, 0x01, 0x02, 0x00, 0x18, 0x04, 0x00, 0x05, 0x0E, 0x05, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x05, 0x01, 0x02, 0x12, 0x02, 0x01,  // n
+        0x24, 0x00, 0x28, 0x00, 0x2C, 0x00, 0x30, 0x00, 0x33, 0x00, 0x38, 0x00, 0x3D, 0x00, 0x42, 0x00, 0x47, 0x00, 0x4C, 0x00, 0x51, 0x00, 0x56, 0x00, 0x5B, 0x00, 0x60, 0x00, 0x65, 0x00, 0x68, 0x00, 0x6C, 0x00, 0x70, 0x00, 0x03, 0x05, 0x0F, 0x04, 0x03, 0x03, 0x13, 0x02, 0x03, 0x01, 0x16, 0x01, 0x02, 0x01, 0x17, 0x04, 0x00, 0x06, 0x0D, 0x05, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x05, 0x0D, 0x06, 0x02, 0x00, 0x18, 0x03, 0x01, 0x16, 0x01, 0x03, 0x02, 0x14, 0x02, 0x03, 0x05, 0x0F, 0x04,  // o
+        0x2E, 0x00, 0x32, 0x00, 0x36, 0x00, 0x3A, 0x00, 0x3D, 0x00, 0x42, 0x00, 0x47, 0x00, 0x4C, 0x00, 0x51, 0x00, 0x56, 0x00, 0x5B, 0x00, 0x60, 0x00, 0x65, 0x00, 0x6A, 0x00, 0x6F, 0x00, 0x72, 0x00, 0x76, 0x00, 0x7A, 0x00, 0x7E, 0x00, 0x82, 0x00, 0x86, 0x00, 0x8A, 0x00, 0x8E, 0x00, 0x03, 0x04, 0x10, 0x04, 0x03, 0x02, 0x14, 0x02, 0x03, 0x01, 0x16, 0x01, 0x02, 0x00, 0x18, 0x04, 0x00, 0x05, 0x0E, 0x05, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x10, 0x04, 0x04, 0x00, 0x04, 0x0F, 0x05, 0x02, 0x00, 0x18, 0x03, 0x00, 0x17, 0x01, 0x03, 0x00, 0x16, 0x02, 0x03, 0x00, 0x14, 0x04, 0x03, 0x00, 0x04, 0x14, 0x03, 0x00, 0x04, 0x14, 0x03, 0x00, 0x04, 0x14, 0x03, 0x00, 0x04, 0x14, 0x03, 0x01, 0x02, 0x15,  // p
+        0x2E, 0x00, 0x32, 0x00, 0x36, 0x00, 0x3A, 0x00, 0x3D, 0x00, 0x42, 0x00, 0x47, 0x00, 0x4C, 0x00, 0x51, 0x00, 0x56, 0x00, 0x5B, 0x00, 0x60, 0x00, 0x65, 0x00, 0x6A, 0x00, 0x6F, 0x00, 0x72, 0x00, 0x75, 0x00, 0x78, 0x00, 0x7B, 0x00, 0x7E, 0x00, 0x81, 0x00, 0x84, 0x00, 0x87, 0x00, 0x03, 0x05, 0x10, 0x04, 0x03, 0x02, 0x15, 0x02, 0x03, 0x01, 0x17, 0x01, 0x02, 0x00, 0x19, 0x04, 0x00, 0x05, 0x0F, 0x05, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x05, 0x10, 0x04, 0x02, 0x00, 0x19, 0x02, 0x01, 0x18, 0x02, 0x02, 0x17, 0x02, 0x04, 0x15, 0x02, 0x15, 0x04, 0x02, 0x15, 0x04, 0x02, 0x15, 0x04, 0x02, 0x15, 0x04, 0x02, 0x15, 0x04,  // q
+        0x24, 0x00, 0x28, 0x00, 0x2B, 0x00, 0x2E, 0x00, 0x32, 0x00, 0x36, 0x00, 0x3A, 0x00, 0x3E, 0x00, 0x42, 0x00, 0x46, 0x00, 0x4A, 0x00, 0x4E, 0x00, 0x52, 0x00, 0x56, 0x00, 0x5A, 0x00, 0x5E, 0x00, 0x62, 0x00, 0x66, 0x00, 0x03, 0x05, 0x05, 0x01, 0x02, 0x02, 0x09, 0x02, 0x01, 0x0A, 0x03, 0x00, 0x0A, 0x01, 0x03, 0x00, 0x05, 0x06, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x01, 0x02, 0x08,  // r
+        0x24, 0x00, 0x28, 0x00, 0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x40, 0x00, 0x44, 0x00, 0x48, 0x00, 0x4C, 0x00, 0x4F, 0x00, 0x52, 0x00, 0x55, 0x00, 0x58, 0x00, 0x5B, 0x00, 0x5F, 0x00, 0x63, 0x00, 0x03, 0x04, 0x08, 0x09, 0x03, 0x02, 0x0B, 0x08, 0x03, 0x01, 0x0C, 0x08, 0x03, 0x00, 0x0C, 0x09, 0x03, 0x00, 0x04, 0x11, 0x03, 0x00, 0x04, 0x11, 0x03, 0x00, 0x05, 0x10, 0x03, 0x00, 0x12, 0x03, 0x03, 0x01, 0x13, 0x01, 0x03, 0x02, 0x12, 0x01, 0x02, 0x04, 0x11, 0x02, 0x11, 0x04, 0x02, 0x11, 0x04, 0x02, 0x10, 0x05, 0x02, 0x01, 0x14, 0x03, 0x00, 0x14, 0x01, 0x03, 0x00, 0x13, 0x02, 0x03, 0x01, 0x11, 0x03,  // s
+        0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x40, 0x00, 0x44, 0x00, 0x47, 0x00, 0x4A, 0x00, 0x4E, 0x00, 0x52, 0x00, 0x56, 0x00, 0x5A, 0x00, 0x5E, 0x00, 0x62, 0x00, 0x66, 0x00, 0x6A, 0x00, 0x6E, 0x00, 0x72, 0x00, 0x76, 0x00, 0x7A, 0x00, 0x7E, 0x00, 0x03, 0x04, 0x02, 0x08, 0x03, 0x03, 0x04, 0x07, 0x03, 0x03, 0x04, 0x07, 0x03, 0x03, 0x04, 0x07, 0x03, 0x03, 0x04, 0x07, 0x03, 0x01, 0x0C, 0x01, 0x02, 0x00, 0x0E, 0x02, 0x00, 0x0E, 0x03, 0x01, 0x0C, 0x01, 0x03, 0x03, 0x04, 0x07, 0x03, 0x03, 0x04, 0x07, 0x03, 0x03, 0x04, 0x07, 0x03, 0x03, 0x04, 0x07, 0x03, 0x03, 0x04, 0x07, 0x03, 0x03, 0x04, 0x07, 0x03, 0x03, 0x04, 0x07, 0x03, 0x03, 0x04, 0x07, 0x03, 0x03, 0x04, 0x07, 0x03, 0x03, 0x04, 0x07, 0x03, 0x03, 0x04, 0x07, 0x03, 0x03, 0x04, 0x07, 0x03, 0x04, 0x02, 0x08,  // t
+        0x22, 0x00, 0x28, 0x00, 0x2D, 0x00, 0x32, 0x00, 0x37, 0x00, 0x3C, 0x00, 0x41, 0x00, 0x46, 0x00, 0x4B, 0x00, 0x50, 0x00, 0x55, 0x00, 0x5A, 0x00, 0x5F, 0x00, 0x64, 0x00, 0x67, 0x00, 0x6B, 0x00, 0x6F, 0x00, 0x05, 0x01, 0x02, 0x13, 0x02, 0x01, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x00, 0x19, 0x03, 0x01, 0x17, 0x01, 0x03, 0x02, 0x15, 0x02, 0x03, 0x05, 0x0F, 0x05,  // u
+        0x24, 0x00, 0x2A, 0x00, 0x2F, 0x00, 0x35, 0x00, 0x3B, 0x00, 0x41, 0x00, 0x47, 0x00, 0x4D, 0x00, 0x53, 0x00, 0x59, 0x00, 0x5F, 0x00, 0x65, 0x00, 0x6B, 0x00, 0x71, 0x00, 0x75, 0x00, 0x79, 0x00, 0x7D, 0x00, 0x81, 0x00, 0x05, 0x01, 0x03, 0x15, 0x03, 0x01, 0x04, 0x00, 0x05, 0x13, 0x05, 0x05, 0x01, 0x05, 0x11, 0x05, 0x01, 0x05, 0x02, 0x05, 0x10, 0x04, 0x02, 0x05, 0x03, 0x04, 0x0F, 0x04, 0x03, 0x05, 0x04, 0x04, 0x0D, 0x05, 0x03, 0x05, 0x04, 0x05, 0x0B, 0x05, 0x04, 0x05, 0x05, 0x05, 0x09, 0x05, 0x05, 0x05, 0x06, 0x05, 0x07, 0x05, 0x06, 0x05, 0x07, 0x05, 0x06, 0x04, 0x07, 0x05, 0x08, 0x04, 0x05, 0x05, 0x07, 0x05, 0x08, 0x05, 0x03, 0x05, 0x08, 0x05, 0x09, 0x05, 0x01, 0x05, 0x09, 0x03, 0x0A, 0x09, 0x0A, 0x03, 0x0B, 0x07, 0x0B, 0x03, 0x0C, 0x05, 0x0C, 0x03, 0x0D, 0x04, 0x0C, 0x03, 0x0E, 0x02, 0x0D,  // v
+        0x22, 0x00, 0x2A, 0x00, 0x31, 0x00, 0x39, 0x00, 0x41, 0x00, 0x49, 0x00, 0x51, 0x00, 0x5B, 0x00, 0x65, 0x00, 0x6F, 0x00, 0x79, 0x00, 0x83, 0x00, 0x8B, 0x00, 0x91, 0x00, 0x97, 0x00, 0x9D, 0x00, 0xA3, 0x00, 0x07, 0x01, 0x02, 0x0D, 0x02, 0x0D, 0x03, 0x01, 0x06, 0x00, 0x04, 0x0B, 0x04, 0x0C, 0x04, 0x07, 0x00, 0x04, 0x0B, 0x05, 0x0A, 0x04, 0x01, 0x07, 0x01, 0x04, 0x09, 0x06, 0x0A, 0x04, 0x01, 0x07, 0x01, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02, 0x07, 0x02, 0x04, 0x07, 0x09, 0x07, 0x04, 0x02, 0x09, 0x02, 0x04, 0x06, 0x05, 0x01, 0x04, 0x06, 0x04, 0x03, 0x09, 0x03, 0x04, 0x05, 0x04, 0x02, 0x05, 0x04, 0x05, 0x03, 0x09, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x09, 0x04, 0x04, 0x03, 0x04, 0x04, 0x05, 0x02, 0x05, 0x04, 0x09, 0x04, 0x04, 0x02, 0x04, 0x06, 0x04, 0x02, 0x04, 0x05, 0x07, 0x05, 0x04, 0x01, 0x04, 0x07, 0x09, 0x05, 0x05, 0x05, 0x08, 0x08, 0x08, 0x06, 0x05, 0x06, 0x07, 0x09, 0x07, 0x06, 0x05, 0x06, 0x06, 0x0A, 0x06, 0x07, 0x05, 0x07, 0x05, 0x0B, 0x05, 0x07, 0x05, 0x07, 0x04, 0x0C, 0x04, 0x08,  // w
+        0x22, 0x00, 0x28, 0x00, 0x2D, 0x00, 0x33, 0x00, 0x39, 0x00, 0x3F, 0x00, 0x45, 0x00, 0x49, 0x00, 0x4D, 0x00, 0x51, 0x00, 0x55, 0x00, 0x59, 0x00, 0x5F, 0x00, 0x65, 0x00, 0x6B, 0x00, 0x71, 0x00, 0x76, 0x00, 0x05, 0x01, 0x03, 0x10, 0x03, 0x01, 0x04, 0x00, 0x05, 0x0D, 0x06, 0x05, 0x01, 0x05, 0x0B, 0x06, 0x01, 0x05, 0x02, 0x06, 0x08, 0x06, 0x02, 0x05, 0x03, 0x06, 0x05, 0x06, 0x04, 0x05, 0x05, 0x05, 0x03, 0x06, 0x05, 0x03, 0x06, 0x0B, 0x07, 0x03, 0x07, 0x09, 0x08, 0x03, 0x09, 0x06, 0x09, 0x03, 0x07, 0x09, 0x08, 0x03, 0x06, 0x0C, 0x06, 0x05, 0x05, 0x05, 0x03, 0x06, 0x05, 0x05, 0x03, 0x06, 0x06, 0x05, 0x04, 0x05, 0x02, 0x06, 0x08, 0x06, 0x02, 0x05, 0x01, 0x05, 0x0B, 0x06, 0x01, 0x04, 0x00, 0x05, 0x0E, 0x05, 0x05, 0x01, 0x02, 0x11, 0x03, 0x01,  // x
+        0x2C, 0x00, 0x32, 0x00, 0x37, 0x00, 0x3C, 0x00, 0x41, 0x00, 0x46, 0x00, 0x4B, 0x00, 0x50, 0x00, 0x55, 0x00, 0x5A, 0x00, 0x5F, 0x00, 0x64, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x71, 0x00, 0x74, 0x00, 0x77, 0x00, 0x7A, 0x00, 0x7D, 0x00, 0x80, 0x00, 0x84, 0x00, 0x88, 0x00, 0x05, 0x01, 0x02, 0x13, 0x02, 0x01, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x04, 0x11, 0x04, 0x04, 0x00, 0x05, 0x10, 0x04, 0x02, 0x00, 0x19, 0x02, 0x01, 0x18, 0x02, 0x02, 0x17, 0x02, 0x04, 0x15, 0x02, 0x15, 0x04, 0x02, 0x0D, 0x0C, 0x03, 0x0C, 0x0C, 0x01, 0x03, 0x0C, 0x0B, 0x02, 0x03, 0x0D, 0x08, 0x04,  // y
+        0x22, 0x00, 0x26, 0x00, 0x2A, 0x00, 0x2E, 0x00, 0x32, 0x00, 0x36, 0x00, 0x3A, 0x00, 0x3E, 0x00, 0x42, 0x00, 0x46, 0x00, 0x4A, 0x00, 0x4E, 0x00, 0x52, 0x00, 0x56, 0x00, 0x5A, 0x00, 0x5D, 0x00, 0x60, 0x00, 0x03, 0x09, 0x0E, 0x01, 0x03, 0x08, 0x0F, 0x01, 0x03, 0x08, 0x0F, 0x01, 0x03, 0x09, 0x0D, 0x02, 0x03, 0x0E, 0x06, 0x04, 0x03, 0x0D, 0x05, 0x06, 0x03, 0x0B, 0x06, 0x07, 0x03, 0x0A, 0x05, 0x09, 0x03, 0x08, 0x06, 0x0A, 0x03, 0x07, 0x05, 0x0C, 0x03, 0x05, 0x05, 0x0E, 0x03, 0x03, 0x06, 0x0F, 0x03, 0x02, 0x05, 0x11, 0x03, 0x00, 0x17, 0x01, 0x02, 0x00, 0x18, 0x02, 0x00, 0x18, 0x03, 0x01, 0x16, 0x01,  // z
+        0x3A, 0x00, 0x3E, 0x00, 0x41, 0x00, 0x44, 0x00, 0x48, 0x00, 0x4C, 0x00, 0x50, 0x00, 0x54, 0x00, 0x58, 0x00, 0x5C, 0x00, 0x60, 0x00, 0x64, 0x00, 0x68, 0x00, 0x6C, 0x00, 0x70, 0x00, 0x74, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x80, 0x00, 0x84, 0x00, 0x88, 0x00, 0x8C, 0x00, 0x90, 0x00, 0x94, 0x00, 0x98, 0x00, 0x9C, 0x00, 0xA0, 0x00, 0xA3, 0x00, 0xA6, 0x00, 0x03, 0x04, 0x05, 0x01, 0x02, 0x03, 0x07, 0x02, 0x02, 0x08, 0x03, 0x02, 0x07, 0x01, 0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x03, 0x05, 0x03, 0x02, 0x03, 0x05, 0x03, 0x01, 0x04, 0x05, 0x03, 0x00, 0x04, 0x06, 0x03, 0x00, 0x05, 0x05, 0x03, 0x02, 0x03, 0x05, 0x03, 0x02, 0x03, 0x05, 0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x04, 0x04, 0x03, 0x02, 0x07, 0x01, 0x02, 0x02, 0x08, 0x02, 0x03, 0x07, 0x03, 0x04, 0x05, 0x01,  // {
+        0x3A, 0x00, 0x3E, 0x00, 0x41, 0x00, 0x44, 0x00, 0x47, 0x00, 0x4A, 0x00, 0x4D, 0x00, 0x50, 0x00, 0x53, 0x00, 0x56, 0x00, 0x59, 0x00, 0x5C, 0x00, 0x5F, 0x00, 0x62, 0x00, 0x65, 0x00, 0x68, 0x00, 0x6B, 0x00, 0x6E, 0x00, 0x71, 0x00, 0x74, 0x00, 0x77, 0x00, 0x7A, 0x00, 0x7D, 0x00, 0x80, 0x00, 0x83, 0x00, 0x86, 0x00, 0x89, 0x00, 0x8C, 0x00, 0x8F, 0x00, 0x03, 0x01, 0x02, 0x01, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x03, 0x01, 0x02, 0x01,  // |
+        0x3A, 0x00, 0x3E, 0x00, 0x42, 0x00, 0x46, 0x00, 0x4A, 0x00, 0x4E, 0x00, 0x52, 0x00, 0x56, 0x00, 0x5A, 0x00, 0x5E, 0x00, 0x62, 0x00, 0x66, 0x00, 0x6A, 0x00, 0x6E, 0x00, 0x72, 0x00, 0x75, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x80, 0x00, 0x84, 0x00, 0x88, 0x00, 0x8C, 0x00, 0x90, 0x00, 0x94, 0x00, 0x98, 0x00, 0x9C, 0x00, 0xA0, 0x00, 0xA4, 0x00, 0xA8, 0x00, 0x03, 0x01, 0x05, 0x04, 0x03, 0x00, 0x07, 0x03, 0x03, 0x00, 0x08, 0x02, 0x03, 0x01, 0x07, 0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x05, 0x03, 0x02, 0x03, 0x05, 0x03, 0x02, 0x03, 0x05, 0x04, 0x01, 0x02, 0x06, 0x04, 0x02, 0x05, 0x05, 0x03, 0x05, 0x03, 0x02, 0x03, 0x05, 0x03, 0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x02, 0x06, 0x02, 0x03, 0x01, 0x07, 0x02, 0x03, 0x01, 0x06, 0x03, 0x03, 0x02, 0x04, 0x04,  // }
+        0x16, 0x00, 0x1A, 0x00, 0x1E, 0x00, 0x24, 0x00, 0x29, 0x00, 0x30, 0x00, 0x37, 0x00, 0x3E, 0x00, 0x43, 0x00, 0x49, 0x00, 0x4D, 0x00, 0x03, 0x03, 0x09, 0x0F, 0x03, 0x02, 0x0C, 0x0D, 0x05, 0x01, 0x0E, 0x09, 0x02, 0x01, 0x04, 0x00, 0x0F, 0x08, 0x04, 0x06, 0x00, 0x04, 0x07, 0x04, 0x08, 0x04, 0x06, 0x00, 0x04, 0x08, 0x04, 0x07, 0x04, 0x06, 0x00, 0x04, 0x08, 0x04, 0x07, 0x04, 0x04, 0x00, 0x04, 0x08, 0x0F, 0x05, 0x01, 0x02, 0x09, 0x0E, 0x01, 0x03, 0x0D, 0x0C, 0x02, 0x03, 0x0F, 0x09, 0x03,  // ~
+        0x3A, 0x00, 0x3E, 0x00, 0x41, 0x00, 0x46, 0x00, 0x4B, 0x00, 0x50, 0x00, 0x55, 0x00, 0x5A, 0x00, 0x5F, 0x00, 0x64, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x78, 0x00, 0x7D, 0x00, 0x82, 0x00, 0x87, 0x00, 0x8C, 0x00, 0x91, 0x00, 0x96, 0x00, 0x9B, 0x00, 0xA0, 0x00, 0xA5, 0x00, 0xAA, 0x00, 0xAF, 0x00, 0xB4, 0x00, 0xB9, 0x00, 0xBE, 0x00, 0xC1, 0x00, 0x03, 0x01, 0x0D, 0x01, 0x02, 0x00, 0x0F, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x04, 0x00, 0x02, 0x0B, 0x02, 0x02, 0x00, 0x0F, 0x03, 0x01, 0x0D, 0x01,  // DEL
+};
+
+const packed_glyph_t Neu42x35_runs_glyphs[] = {
+        {     0, 33,  0,  0,  0,  0 },  // space
+        {     0, 33,  1,  7,  5, 22 },  // !
+        {   113, 33,  1,  7, 10,  8 },  // "
+        {   172, 33,  1,  8, 25, 21 },  // #
+        {   322, 33,  1,  5, 25, 26 },  // $
+        {   491, 33,  1,  7, 33, 23 },  // %
+        {   673, 33,  1,  7, 29, 22 },  // &
+        {   841, 33,  1,  7,  5,  8 },  // '
+        {   884, 33,  1,  7,  8, 22 },  // (
+        {  1014, 33,  1,  7,  8, 22 },  // )
+        {  1132, 33,  2, 10, 16, 12 },  // *
+        {  1224, 33,  0, 13, 14, 10 },  // +
+        {  1282, 33,  1, 24,  5,  8 },  // ,
+        {  1326, 33,  1, 18, 15,  4 },  // -
+        {  1347, 33,  1, 25,  5,  4 },  // .
+        {  1369, 33,  0,  7, 25, 22 },  // /
+        {  1500, 33,  2,  7, 26, 22 },  // 0
+        {  1646, 33,  3,  7,  7, 22 },  // 1
+        {  1758, 33,  1,  7, 28, 22 },  // 2
+        {  1882, 33,  2,  7, 28, 22 },  // 3
+        {  2001, 33,  1,  7, 30, 22 },  // 4
+        {  2139, 33,  1,  7, 28, 22 },  // 5
+        {  2263, 33,  1,  7, 29, 22 },  // 6
+        {  2401, 33,  1,  7, 28, 22 },  // 7
+        {  2531, 33,  1,  7, 28, 22 },  // 8
+        {  2671, 33,  1,  7, 28, 22 },  // 9
+        {  2802, 33,  1, 17,  4, 12 },  // :
+        {  2862, 33,  1, 17,  6, 15 },  // ;
+        {  2943, 33,  1, 11, 17, 14 },  // <
+        {  3023, 33,  1, 15, 15,  9 },  // =
+        {  3069, 33,  1, 11, 17, 14 },  // >
+        {  3151, 33,  1,  7, 18, 22 },  // ?
+        {  3274, 33,  1,  6, 23, 21 },  // @
+        {  3441, 33,  0,  7, 31, 22 },  // A
+        {  3599, 33,  1,  7, 28, 22 },  // B
+        {  3741, 33,  1,  7, 25, 22 },  // C
+        {  3869, 33,  1,  7, 28, 22 },  // D
+        {  4014, 33,  1,  7, 25, 22 },  // E
+        {  4142, 33,  1,  7, 25, 22 },  // F
+        {  4272, 33,  1,  7, 27, 22 },  // G
+        {  4414, 33,  1,  7, 28, 22 },  // H
+        {  4562, 33,  1,  7,  4, 22 },  // I
+        {  4674, 33,  1,  7, 12, 22 },  // J
+        {  4789, 33,  1,  7, 25, 22 },  // K
+        {  4956, 33,  1,  7, 25, 22 },  // L
+        {  5086, 33,  1,  7, 38, 22 },  // M
+        {  5292, 33,  1,  7, 28, 22 },  // N
+        {  5468, 33,  1,  7, 27, 22 },  // O
+        {  5613, 33,  1,  7, 27, 22 },  // P
+        {  5751, 33,  1,  7, 28, 25 },  // Q
+        {  5914, 33,  1,  7, 27, 22 },  // R
+        {  6066, 33,  1,  7, 24, 22 },  // S
+        {  6191, 33,  1,  7, 24, 22 },  // T
+        {  6321, 33,  1,  7, 28, 22 },  // U
+        {  6472, 33,  0,  7, 32, 22 },  // V
+        {  6637, 33,  0,  7, 42, 22 },  // W
+        {  6863, 33,  0,  7, 28, 22 },  // X
+        {  7026, 33,  1,  7, 27, 22 },  // Y
+        {  7175, 33,  1,  7, 25, 22 },  // Z
+        {  7305, 33,  1,  7,  8, 22 },  // [
+        {  7433, 33,  0,  7, 24, 22 },  // backslash
+        {  7563, 33,  1,  7,  8, 22 },  // ]
+        {  7675, 33,  1,  3, 12,  7 },  // ^
+        {  7723, 33,  0, 31, 27,  4 },  // _
+        {  7745, 33,  3,  4,  7,  7 },  // `
+        {  7785, 33,  1, 11, 26, 18 },  // a
+        {  7891, 33,  1,  7, 24, 22 },  // b
+        {  8030, 33,  1, 11, 25, 18 },  // c
+        {  8134, 33,  2,  7, 24, 22 },  // d
+        {  8266, 33,  1, 11, 23, 18 },  // e
+        {  8373, 33,  1,  7, 11, 22 },  // f
+        {  8501, 33,  1, 12, 24, 22 },  // g
+        {  8635, 33,  2,  7, 24, 22 },  // h
+        {  8780, 33,  1,  7,  5, 22 },  // i
+        {  8893, 33,  0,  7, 12, 26 },  // j
+        {  9028, 33,  1,  7, 20, 22 },  // k
+        {  9181, 33,  1,  7,  4, 22 },  // l
+        {  9293, 33,  1, 11, 33, 18 },  // m
+        {  9445, 33,  1, 11, 24, 18 },  // n
+        {  9567, 33,  1, 11, 24, 18 },  // o
+        {  9683, 33,  1, 11, 24, 23 },  // p
+        {  9829, 33,  1, 11, 25, 23 },  // q
+        {  9967, 33,  1, 11, 11, 18 },  // r
+        { 10073, 33,  1, 11, 21, 18 },  // s
+        { 10176, 33,  0,  7, 14, 22 },  // t
+        { 10306, 33,  1, 12, 25, 17 },  // u
+        { 10421, 33,  0, 12, 29, 18 },  // v
+        { 10554, 33,  1, 12, 35, 17 },  // w
+        { 10723, 33,  1, 12, 24, 17 },  // x
+        { 10847, 33,  1, 12, 25, 22 },  // y
+        { 10987, 33,  1, 12, 24, 17 },  // z
+        { 11087, 33,  1,  3, 10, 29 },  // {
+        { 11257, 33,  1,  5,  4, 29 },  // |
+        { 11404, 33,  1,  3, 10, 29 },  // }
+        { 11576, 33,  1,  9, 27, 11 },  // ~
+        { 11657, 33,  2,  0, 15, 29 },  // DEL
+};
+
+const packed_font_t Neu42x35_runs = { 32, 127, 42, 35, PACKED_FONT_RUNS, Neu42x35_runs_glyphs, Neu42x35_runs_bitmap };
+
+#endif
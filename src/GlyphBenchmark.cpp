@@ -0,0 +1,59 @@
+#ifdef BENCHMARK_GLYPHS
+
+#include "GlyphBenchmark.h"
+
+#include <mbed.h>
+#include <stdio.h>
+
+#include <chrono>
+
+#include "Neu42x35_packed.h"
+#include "Neu42x35_runs.h"
+
+using namespace std::chrono;
+
+void benchmarkGlyphs(SPI_TFT_ILI9341* tft) {
+    const packed_font_t* fonts[] = {&Neu42x35_packed, &Neu42x35_runs};
+    const char* names[] = {"bits", "runs"};
+    uint16_t line[256];
+    Timer timer;
+
+    tft->set_orientation(3);
+    tft->cls();
+
+    for (int f = 0; f < 2; f++) {
+        const packed_font_t* font = fonts[f];
+
+        // cpu cost only: expand every row of every digit like the compositor does
+        timer.reset();
+        timer.start();
+        for (int round = 0; round < BENCHMARK_ROUNDS; round++) {
+            for (char c = '0'; c <= '9'; c++) {
+                const packed_glyph_t* glyph = packed_font_glyph(font, c);
+                for (int row = 0; row < font->vert; row++) {
+                    packed_font_row(font, glyph, row, line, White, Black);
+                }
+            }
+        }
+        timer.stop();
+        int64_t expandUs = duration_cast<microseconds>(timer.elapsed_time()).count();
+
+        // whole glyphs through the driver, including the SPI transfers
+        tft->set_font(font);
+        timer.reset();
+        timer.start();
+        for (int round = 0; round < BENCHMARK_ROUNDS; round++) {
+            for (char c = '0'; c <= '9'; c++) {
+                tft->locate((c - '0') % 5 * font->hor, f * 2 * font->vert + (c - '0') / 5 * font->vert);
+                tft->printf("%c", c);
+            }
+        }
+        timer.stop();
+        int64_t drawUs = duration_cast<microseconds>(timer.elapsed_time()).count();
+
+        printf("%s: expand %d us, draw %d us per 10 digits\n", names[f],
+               (int)(expandUs / BENCHMARK_ROUNDS), (int)(drawUs / BENCHMARK_ROUNDS));
+    }
+}
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef _GLYPH_BENCHMARK_H_
+#define _GLYPH_BENCHMARK_H_
+
+#include "SPI_TFT_ILI9341.h"
+
+#define BENCHMARK_ROUNDS 100
+
+/**
+ * @brief Times the packed bit and run-length encodings of the big font on the digits 0-9 and prints the results
+ *
+ * Only built with -D BENCHMARK_GLYPHS, it draws over the whole screen.
+ */
+void benchmarkGlyphs(SPI_TFT_ILI9341* tft);
+
+#endif
@@ -6,4 +6,5 @@ Animation::Animation(Shape* shape) : _shape(shape) {
 
 void Animation::stop() {
 	_shape->clear();
+	_shape->setVisible(false);
 }
\ No newline at end of file
@@ -5,9 +5,11 @@
 
 class Animation {
 	public:
-		Animation(Shape* shape);
+		Animation(Shape* shape = nullptr);
 		virtual ~Animation() { }
 		virtual void run(int64_t millis) = 0;
+		// earliest time (same clock as run) at which run would change something
+		virtual int64_t nextDeadline() const = 0;
 		virtual void stop();
 
 	protected:
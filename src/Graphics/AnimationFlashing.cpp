@@ -1,5 +1,12 @@
 #include "AnimationFlashing.h"
 
+void AnimationFlashing::init(Shape* shape, int64_t interval) {
+	_shape = shape;
+	_interval = interval;
+	_lastTimeMillis = 0;
+	_isDrawn = false;
+}
+
 void AnimationFlashing::run(int64_t millis) {
 	if (millis > _lastTimeMillis + _interval) {
 		_lastTimeMillis = millis;
@@ -10,5 +17,6 @@ void AnimationFlashing::run(int64_t millis) {
 			_shape->draw();
 
 		_isDrawn = !_isDrawn;
+		_shape->setVisible(_isDrawn);
 	}
 }
\ No newline at end of file
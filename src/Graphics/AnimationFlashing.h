@@ -5,8 +5,11 @@
 
 class AnimationFlashing : public Animation {
 	public:
+		AnimationFlashing() : _interval(0) { }
 		AnimationFlashing(Shape* shape, int64_t interval) : Animation(shape), _interval(interval) { }
+		void init(Shape* shape, int64_t interval);
 		void run(int64_t millis);
+		int64_t nextDeadline() const { return _lastTimeMillis + _interval + 1; }
 		
 	private:
 		int64_t _interval;
@@ -0,0 +1,100 @@
+#include "AnimationScheduler.h"
+
+AnimationScheduler::AnimationScheduler() : _heapSize(0) {
+	for (int i = 0; i < ANIMATION_SLOTS; i++) {
+		_keys[i] = ANIMATION_NONE;
+	}
+}
+
+bool AnimationScheduler::start(int key, Shape* shape, int64_t interval) {
+	if (_findSlot(key) != ANIMATION_NONE)
+		return true;
+
+	int slot = _findSlot(ANIMATION_NONE);
+	if (slot == ANIMATION_NONE)
+		return false;
+
+	_keys[slot] = key;
+	_slots[slot].init(shape, interval);
+	_deadlines[slot] = _slots[slot].nextDeadline();
+	_heap[_heapSize] = slot;
+	_heapIndex[slot] = _heapSize;
+	_siftUp(_heapSize++);
+	return true;
+}
+
+void AnimationScheduler::stop(int key) {
+	int slot = _findSlot(key);
+	if (slot == ANIMATION_NONE)
+		return;
+
+	_slots[slot].stop();
+	_keys[slot] = ANIMATION_NONE;
+
+	// move the last entry into the hole, it may belong above or below it
+	int index = _heapIndex[slot];
+	_heapSize--;
+	if (index == _heapSize)
+		return;
+	uint8_t moved = _heap[_heapSize];
+	_heap[index] = moved;
+	_heapIndex[moved] = index;
+	_siftUp(index);
+	_siftDown(_heapIndex[moved]);
+}
+
+void AnimationScheduler::run(int64_t millis) {
+	// a due animation always steps, which moves its deadline past millis, so this ends
+	while (_heapSize > 0 && _deadlines[_heap[0]] <= millis) {
+		int slot = _heap[0];
+		_slots[slot].run(millis);
+		_deadlines[slot] = _slots[slot].nextDeadline();
+		_siftDown(0);
+	}
+}
+
+int64_t AnimationScheduler::nextDeadline() const {
+	return _heapSize > 0 ? _deadlines[_heap[0]] : INT64_MAX;
+}
+
+int AnimationScheduler::_findSlot(int key) const {
+	for (int i = 0; i < ANIMATION_SLOTS; i++) {
+		if (_keys[i] == key)
+			return i;
+	}
+	return ANIMATION_NONE;
+}
+
+void AnimationScheduler::_swap(int a, int b) {
+	uint8_t slot = _heap[a];
+	_heap[a] = _heap[b];
+	_heap[b] = slot;
+	_heapIndex[_heap[a]] = a;
+	_heapIndex[_heap[b]] = b;
+}
+
+void AnimationScheduler::_siftUp(int index) {
+	while (index > 0) {
+		int parent = (index - 1) / 2;
+		if (_deadlines[_heap[parent]] <= _deadlines[_heap[index]])
+			break;
+		_swap(index, parent);
+		index = parent;
+	}
+}
+
+void AnimationScheduler::_siftDown(int index) {
+	while (true) {
+		int smallest = index;
+		int left = 2 * index + 1;
+		int right = left + 1;
+		if (left < _heapSize && _deadlines[_heap[left]] < _deadlines[_heap[smallest]])
+			smallest = left;
+		if (right < _heapSize && _deadlines[_heap[right]] < _deadlines[_heap[smallest]])
+			smallest = right;
+		if (smallest == index)
+			break;
+		_swap(index, smallest);
+		index = smallest;
+	}
+}
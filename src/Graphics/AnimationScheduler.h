@@ -0,0 +1,61 @@
+#ifndef _ANIMATION_SCHEDULER_H_
+#define _ANIMATION_SCHEDULER_H_
+
+#include <stdint.h>
+
+#include "AnimationFlashing.h"
+
+#define ANIMATION_SLOTS 8
+#define ANIMATION_NONE -1
+
+/**
+ * @brief Runs flashing animations from a fixed pool of slots, ordered by the time they are next due
+ *
+ * Running animations sit in a binary min-heap on their next deadline, so run() only touches the ones which are
+ * due and nextDeadline() is the top of the heap. Each animation belongs to a key (eg. a graphic id); a key has at
+ * most one animation. Not thread safe, start / stop / run from the thread which draws.
+ */
+class AnimationScheduler {
+	public:
+		AnimationScheduler();
+		~AnimationScheduler() { }
+
+		/**
+		 * @brief starts flashing shape under key, does nothing if key already has an animation
+		 *
+		 * @return false if all slots are taken
+		 */
+		bool start(int key, Shape* shape, int64_t interval);
+
+		/**
+		 * @brief stops the animation of key and frees its slot
+		 */
+		void stop(int key);
+
+		/**
+		 * @brief steps every animation due at millis
+		 */
+		void run(int64_t millis);
+
+		/**
+		 * @brief time (run's clock) at which the next animation is due, INT64_MAX if none is running
+		 */
+		int64_t nextDeadline() const;
+
+		int count() const { return _heapSize; }
+
+	private:
+		AnimationFlashing _slots[ANIMATION_SLOTS];
+		int _keys[ANIMATION_SLOTS];				// key owning the slot, ANIMATION_NONE if free
+		int64_t _deadlines[ANIMATION_SLOTS];	// deadline the slot is ordered by in the heap
+		uint8_t _heap[ANIMATION_SLOTS];			// slot indices, earliest deadline first
+		uint8_t _heapIndex[ANIMATION_SLOTS];	// position of each running slot in the heap
+		int _heapSize;
+
+		int _findSlot(int key) const;
+		void _swap(int a, int b);
+		void _siftUp(int index);
+		void _siftDown(int index);
+};
+
+#endif
@@ -13,4 +13,28 @@ void Bitmap::draw() {
 
 void Bitmap::clear() {
 	_tft->fillrect(_x, _y, _x + _width, _y + _height, _background);
+}
+
+Rect Bitmap::getBounds() {
+	return Rect { _x, _y, _x + _width, _y + _height };
+}
+
+void Bitmap::render(int32_t y, int32_t x0, int32_t x1, uint16_t* line) {
+	int32_t row = y - _y;
+
+	// clear() covers one column / row more than the bitmap itself
+	if (!_visible || row == _height) {
+		_fillSpan(_x, _x + _width, x0, x1, line, _background);
+		return;
+	}
+
+	// bitmap lines are stored bottom up and padded to multiples of 4 bytes
+	const uint16_t* source = (const uint16_t*)_bitmap + (_height - 1 - row) * (_width + (_width & 1));
+	int32_t start = _x > x0 ? _x : x0;
+	int32_t end = _x + _width - 1 < x1 ? _x + _width - 1 : x1;
+
+	for (int32_t x = start; x <= end; x++)
+		line[x - x0] = source[x - _x];
+
+	_fillSpan(_x + _width, _x + _width, x0, x1, line, _background);
 }
\ No newline at end of file
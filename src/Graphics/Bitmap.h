@@ -9,6 +9,8 @@ class Bitmap : public Shape {
 		void init(SPI_TFT_ILI9341* tft, int32_t xpos, int32_t ypos, int32_t width, int32_t height, unsigned char* bitmap);
 		void draw() override;
 		void clear() override;
+		Rect getBounds() override;
+		void render(int32_t y, int32_t x0, int32_t x1, uint16_t* line) override;
 	
 	private:
 		int32_t _width;
@@ -8,11 +8,59 @@ void Circle::init(SPI_TFT_ILI9341* tft, int32_t xpos, int32_t ypos, int32_t colo
 
 void Circle::draw() {
 	if (_fill)
-		_tft->fillcircle(_x, _y, _radius, _colour);
+		_tft->fillcircle(_x, _y, _radius, _colour, _background);
 	else
 		_tft->circle(_x, _y, _radius, _colour);
 }
 
 void Circle::clear() {
-	_tft->fillcircle(_x, _y, _radius, _background);
-}
\ No newline at end of file
+	_tft->fillcircle(_x, _y, _radius, _background, _background);
+}
+
+Rect Circle::getBounds() {
+	return Rect { _x - _radius, _y - _radius, _x + _radius, _y + _radius };
+}
+
+void Circle::render(int32_t y, int32_t x0, int32_t x1, uint16_t* line) {
+	int32_t dy = y > _y ? y - _y : _y - y;
+	int32_t outer = _halfWidth(dy);
+
+	if (outer < 0)
+		return;
+
+	if (_fill || !_visible) {
+		_fillSpan(_x - outer, _x + outer, x0, x1, line, _visible ? _colour : _background);
+	} else {
+		// outline: from the edge of this row in to the edge of the next row out
+		int32_t inner = _halfWidth(dy + 1) + 1;
+		if (inner > outer)
+			inner = outer;
+		_fillSpan(_x - outer, _x - inner, x0, x1, line, _colour);
+		_fillSpan(_x + inner, _x + outer, x0, x1, line, _colour);
+	}
+}
+
+int32_t Circle::_halfWidth(int32_t dy) {
+	if (dy > _radius)
+		return -1;
+
+	// same spans the driver rasterises fillcircle() and circle() from
+	const unsigned short* spans = _tft->circle_spans(_radius);
+	if (spans != nullptr)
+		return spans[dy];
+
+	// too big for the driver's span cache, it falls back to the same Bresenham circle: walk it down to row dy
+	int32_t x = -_radius, y = 0, err = 2 - 2 * _radius, e2;
+	while (y < dy) {
+		e2 = err;
+		if (e2 <= y) {
+			err += ++y * 2 + 1;
+			if (-x == y && e2 <= x)
+				e2 = 0;
+		}
+		if (e2 > x)
+			err += ++x * 2 + 1;
+	}
+
+	return -x;
+}
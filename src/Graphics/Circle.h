@@ -9,10 +9,14 @@ class Circle : public Shape {
 		void init(SPI_TFT_ILI9341* tft, int32_t xpos, int32_t ypos, int32_t colour, int32_t radius, bool _fill);
 		void draw() override;
 		void clear() override;
+		Rect getBounds() override;
+		void render(int32_t y, int32_t x0, int32_t x1, uint16_t* line) override;
 		
 	private:
 		int32_t _radius;
 		bool _fill;
+
+		int32_t _halfWidth(int32_t dy);
 };
 
 #endif
\ No newline at end of file
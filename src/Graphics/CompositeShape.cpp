@@ -17,4 +17,24 @@ void CompositeShape::clear() {
 
 void CompositeShape::addShape(Shape* shape) {
 	_components.push_back(shape);
+}
+
+Rect CompositeShape::getBounds() {
+	Rect bounds { 0, 0, -1, -1 };
+
+	for (Shape* shape : _components)
+		bounds = bounds.isEmpty() ? shape->getBounds() : bounds.merged(shape->getBounds());
+
+	return bounds;
+}
+
+void CompositeShape::render(int32_t y, int32_t x0, int32_t x1, uint16_t* line) {
+	for (Shape* shape : _components) {
+		Rect bounds = shape->getBounds();
+
+		if (y >= bounds.y0 && y <= bounds.y1) {
+			shape->setVisible(_visible);
+			shape->render(y, x0, x1, line);
+		}
+	}
 }
\ No newline at end of file
@@ -12,6 +12,8 @@ class CompositeShape : public Shape {
 		void init(const std::vector<Shape*>& components);
 		void draw() override;
 		void clear() override;
+		Rect getBounds() override;
+		void render(int32_t y, int32_t x0, int32_t x1, uint16_t* line) override;
 		void addShape(Shape* shape);
 
 	private:
@@ -0,0 +1,98 @@
+#include "Compositor.h"
+
+void Compositor::init(SPI_TFT_ILI9341* tft, int32_t background) {
+	_tft = tft;
+	_background = background;
+}
+
+void Compositor::addLayer(Shape* shape) {
+	if (_layerCount < COMPOSITOR_MAX_LAYERS)
+		_layers[_layerCount++] = shape;
+}
+
+void Compositor::invalidate(Shape* shape) {
+	invalidate(shape->getDirtyBounds());
+	shape->markClean();
+}
+
+void Compositor::invalidate(const Rect& region) {
+	if (region.isEmpty())
+		return;
+
+	// merge with overlapping regions as long as the union doesn't repaint more than both separately
+	Rect damage = region;
+	int i = 0;
+	while (i < _damageCount) {
+		Rect merged = damage.merged(_damage[i]);
+
+		if (damage.intersects(_damage[i]) && merged.area() <= damage.area() + _damage[i].area()) {
+			damage = merged;
+			_damage[i] = _damage[--_damageCount];
+			i = 0;
+		} else {
+			i++;
+		}
+	}
+
+	if (_damageCount == COMPOSITOR_MAX_DAMAGE)
+		flush();
+
+	_damage[_damageCount++] = damage;
+}
+
+void Compositor::flush() {
+	for (int i = 0; i < _damageCount; i++)
+		_renderRegion(_damage[i]);
+
+	_damageCount = 0;
+}
+
+void Compositor::_renderRegion(const Rect& damage) {
+	Rect region = damage.intersection(Rect { 0, 0, _tft->width() - 1, _tft->height() - 1 });
+
+	if (region.isEmpty())
+		return;
+
+	// only layers touching the region take part
+	Shape* layers[COMPOSITOR_MAX_LAYERS];
+	Rect bounds[COMPOSITOR_MAX_LAYERS];
+	int layerCount = 0;
+	for (int i = 0; i < _layerCount; i++) {
+		Rect layerBounds = _layers[i]->getBounds();
+
+		if (layerBounds.intersects(region)) {
+			layers[layerCount] = _layers[i];
+			bounds[layerCount++] = layerBounds;
+		}
+	}
+
+	int32_t width = region.width();
+	int32_t rowsPerChunk = TFT_LINE_BUFFER_PIXELS / width;
+	int32_t rows = 0;
+	int buffer = 0;
+	uint16_t* line = _lineBuffer[buffer];
+
+	_tft->begin_stream(region.x0, region.y0, width, region.height());
+
+	for (int32_t y = region.y0; y <= region.y1; y++) {
+		for (int32_t x = 0; x < width; x++)
+			line[x] = _background;
+
+		for (int i = 0; i < layerCount; i++) {
+			if (y >= bounds[i].y0 && y <= bounds[i].y1)
+				layers[i]->render(y, region.x0, region.x1, line);
+		}
+
+		line += width;
+		rows++;
+
+		if (rows == rowsPerChunk || y == region.y1) {
+			_tft->stream_pixels(_lineBuffer[buffer], rows * width);
+			buffer ^= 1;
+			line = _lineBuffer[buffer];
+			rows = 0;
+		}
+	}
+
+	_tft->end_stream();
+}
@@ -0,0 +1,54 @@
+#ifndef _COMPOSITOR_H_
+#define _COMPOSITOR_H_
+
+#include "Shape.h"
+
+#define COMPOSITOR_MAX_LAYERS 24
+#define COMPOSITOR_MAX_DAMAGE 16
+
+/**
+ * @brief Collects damaged screen regions and repaints each one once from the registered shapes
+ * 
+ * Regions are rendered into a small line buffer and streamed to the display through a single
+ * draw window, so overlapping updates (eg. Text::clear followed by Text::draw) cost one pass.
+ * Pixels of a damaged region not covered by any layer are painted with the background colour.
+ */
+class Compositor {
+	public:
+		Compositor() { }
+		~Compositor() { }
+		void init(SPI_TFT_ILI9341* tft, int32_t background = Black);
+
+		/**
+		 * @brief adds a shape to the composition; layers are painted in the order they were added
+		 */
+		void addLayer(Shape* shape);
+
+		/**
+		 * @brief marks the region of shape which changed since it was last invalidated as damaged
+		 */
+		void invalidate(Shape* shape);
+
+		/**
+		 * @brief marks a screen region as damaged; overlapping regions are merged
+		 */
+		void invalidate(const Rect& region);
+
+		/**
+		 * @brief repaints all damaged regions
+		 */
+		void flush();
+
+	private:
+		SPI_TFT_ILI9341* _tft;
+		int32_t _background;
+		Shape* _layers[COMPOSITOR_MAX_LAYERS];
+		int _layerCount = 0;
+		Rect _damage[COMPOSITOR_MAX_DAMAGE];
+		int _damageCount = 0;
+		uint16_t _lineBuffer[2][TFT_LINE_BUFFER_PIXELS];	// one is filled while the other is being sent
+
+		void _renderRegion(const Rect& region);
+};
+
+#endif
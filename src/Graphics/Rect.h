@@ -0,0 +1,54 @@
+#ifndef _RECT_H_
+#define _RECT_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Axis aligned screen region, both corners are inclusive (same convention as SPI_TFT_ILI9341::fillrect)
+ */
+struct Rect {
+	int32_t x0;
+	int32_t y0;
+	int32_t x1;
+	int32_t y1;
+
+	int32_t width() const {
+		return x1 - x0 + 1;
+	}
+
+	int32_t height() const {
+		return y1 - y0 + 1;
+	}
+
+	int32_t area() const {
+		return isEmpty() ? 0 : width() * height();
+	}
+
+	bool isEmpty() const {
+		return x1 < x0 || y1 < y0;
+	}
+
+	bool intersects(const Rect& other) const {
+		return x0 <= other.x1 && other.x0 <= x1 && y0 <= other.y1 && other.y0 <= y1;
+	}
+
+	Rect merged(const Rect& other) const {
+		return Rect {
+			x0 < other.x0 ? x0 : other.x0,
+			y0 < other.y0 ? y0 : other.y0,
+			x1 > other.x1 ? x1 : other.x1,
+			y1 > other.y1 ? y1 : other.y1
+		};
+	}
+
+	Rect intersection(const Rect& other) const {
+		return Rect {
+			x0 > other.x0 ? x0 : other.x0,
+			y0 > other.y0 ? y0 : other.y0,
+			x1 < other.x1 ? x1 : other.x1,
+			y1 < other.y1 ? y1 : other.y1
+		};
+	}
+};
+
+#endif
@@ -16,4 +16,21 @@ void Rectangle::draw() {
 
 void Rectangle::clear() {
 	_tft->fillrect(_x, _y, _x2, _y2, _background);
+}
+
+Rect Rectangle::getBounds() {
+	return Rect { _x < _x2 ? _x : _x2, _y < _y2 ? _y : _y2, _x < _x2 ? _x2 : _x, _y < _y2 ? _y2 : _y };
+}
+
+void Rectangle::render(int32_t y, int32_t x0, int32_t x1, uint16_t* line) {
+	Rect bounds = getBounds();
+
+	if (_fill || !_visible) {
+		_fillSpan(bounds.x0, bounds.x1, x0, x1, line, _visible ? _colour : _background);
+	} else if (y == bounds.y0 || y == bounds.y1) {
+		_fillSpan(bounds.x0, bounds.x1, x0, x1, line, _colour);
+	} else {
+		_fillSpan(bounds.x0, bounds.x0, x0, x1, line, _colour);
+		_fillSpan(bounds.x1, bounds.x1, x0, x1, line, _colour);
+	}
 }
\ No newline at end of file
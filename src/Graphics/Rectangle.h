@@ -9,6 +9,8 @@ class Rectangle : public Shape {
 		void init(SPI_TFT_ILI9341* tft, int32_t xpos, int32_t ypos, int32_t colour, int32_t xpos2, int32_t ypos2, bool fill);
 		void draw() override;
 		void clear() override;
+		Rect getBounds() override;
+		void render(int32_t y, int32_t x0, int32_t x1, uint16_t* line) override;
 
 	protected:
 		int32_t _x2;
@@ -13,6 +13,18 @@ void ScalableRectangle::draw() {
 		_tft->fillrect(_x + _scaledWidth, _y, _x2, _y2, _background);
 }
 
+void ScalableRectangle::render(int32_t y, int32_t x0, int32_t x1, uint16_t* line) {
+	if (!_visible) {
+		Rectangle::render(y, x0, x1, line);
+		return;
+	}
+
+	// same pixels as draw(): the column at the scaled edge belongs to the background fill
+	int32_t edge = _scaledWidth != _totalWidth ? _x + _scaledWidth - 1 : _x2;
+	_fillSpan(_x, edge, x0, x1, line, _colour);
+	_fillSpan(edge + 1, _x2, x0, x1, line, _background);
+}
+
 void ScalableRectangle::scale(float percentage) {
 	_scaledWidth = (int32_t)(percentage / 100.0f * (float)_totalWidth);
 }
\ No newline at end of file
@@ -8,6 +8,7 @@ class ScalableRectangle : public Rectangle {
 		~ScalableRectangle() { }
 		void init(SPI_TFT_ILI9341* tft, int32_t xpos, int32_t ypos, int32_t colour, int32_t xpos2, int32_t ypos2, bool fill);
 		void draw() override;
+		void render(int32_t y, int32_t x0, int32_t x1, uint16_t* line) override;
 		void scale(float percentage);
 	
 	private:
@@ -14,4 +14,26 @@ void Shape::setColour(int32_t value) {
 
 int32_t Shape::getColour() {
 	return _colour;
-}
\ No newline at end of file
+}
+
+void Shape::setVisible(bool value) {
+	_visible = value;
+}
+
+bool Shape::isVisible() {
+	return _visible;
+}
+
+Rect Shape::getDirtyBounds() {
+	return getBounds();
+}
+
+void Shape::_fillSpan(int32_t start, int32_t end, int32_t x0, int32_t x1, uint16_t* line, int32_t colour) {
+	if (start < x0)
+		start = x0;
+	if (end > x1)
+		end = x1;
+
+	for (int32_t x = start; x <= end; x++)
+		line[x - x0] = colour;
+}
@@ -2,6 +2,7 @@
 #define _SHAPE_H_
 
 #include "SPI_TFT_ILI9341.h"
+#include "Rect.h"
 
 class Shape {
 	public:
@@ -9,8 +10,32 @@ class Shape {
 		void init(SPI_TFT_ILI9341* tft, int32_t xpos, int32_t ypos, int32_t colour, int32_t background = Black);
 		void setColour(int32_t value);
 		int32_t getColour();
+		void setVisible(bool value);
+		bool isVisible();
 		virtual void draw() = 0;
 		virtual void clear() = 0;
+
+		/**
+		 * @brief screen region covered by draw() / clear() in the shape's current state
+		 */
+		virtual Rect getBounds() = 0;
+
+		/**
+		 * @brief paints row y of the shape (drawn if visible, cleared otherwise) into a line buffer
+		 * 
+		 * @param line buffer holding columns x0..x1 of row y; only pixels covered by the shape are written
+		 */
+		virtual void render(int32_t y, int32_t x0, int32_t x1, uint16_t* line) = 0;
+
+		/**
+		 * @brief screen region which changed since the last markClean(); defaults to the whole shape
+		 */
+		virtual Rect getDirtyBounds();
+
+		/**
+		 * @brief called once the current state has been handed to the display
+		 */
+		virtual void markClean() { }
 		
 	protected:
 		SPI_TFT_ILI9341* _tft;
@@ -18,6 +43,10 @@ class Shape {
 		int32_t _y;
 		int32_t _colour;
 		int32_t _background;
+		bool _visible = false;
+
+		// fills columns start..end of a line buffer holding columns x0..x1
+		static void _fillSpan(int32_t start, int32_t end, int32_t x0, int32_t x1, uint16_t* line, int32_t colour);
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -1,16 +1,15 @@
 #include "Text.h"
 
-void Text::init(SPI_TFT_ILI9341* tft, int32_t xpos, int32_t ypos, unsigned char* font, const std::string& defaultString) {
+void Text::init(SPI_TFT_ILI9341* tft, int32_t xpos, int32_t ypos, const packed_font_t* font, const std::string& defaultString) {
 	Shape::init(tft, xpos, ypos, White);
 	_font = font;
 	_displayString = defaultString;
 	_defaultString = defaultString;
+	_isDrawn = false;
 }
 
 void Text::draw() {
-	_tft->set_font(_font);
-	_tft->locate(_x, _y);
-	_tft->printf(_displayString.c_str());
+	_drawString(_displayString);
 }
 
 void Text::setDisplayString(const std::string& value) {
@@ -18,7 +17,136 @@ void Text::setDisplayString(const std::string& value) {
 }
 
 void Text::clear() {
-	_tft->set_font(_font);
-	_tft->locate(_x, _y);
-	_tft->printf(_defaultString.c_str());
-}
\ No newline at end of file
+	_drawString(_defaultString);
+}
+
+Rect Text::getBounds() {
+	int32_t glyphX[TEXT_MAX_GLYPHS + 1];
+	int count = _layout(_shownString(), glyphX);
+
+	if (count == 0)
+		return Rect { _x, _y, _x - 1, _y - 1 };
+
+	return _cell(glyphX[0]).merged(_cell(glyphX[count - 1]));
+}
+
+void Text::render(int32_t y, int32_t x0, int32_t x1, uint16_t* line) {
+	int32_t hor = _font->hor;
+	int32_t row = y - _y;
+	int32_t x = _x;
+	uint16_t cell[256];
+
+	if (row < 0 || row >= _font->vert)
+		return;
+
+	// every glyph paints its whole cell like SPI_TFT_ILI9341::character(), later glyphs overlap earlier cells
+	for (char c : _shownString()) {
+		const packed_glyph_t* glyph = packed_font_glyph(_font, c);
+		if (glyph == nullptr)
+			continue;
+
+		if (x >= x0 && x + hor - 1 <= x1) {
+			packed_font_row(_font, glyph, row, &line[x - x0], _colour, _background);
+		}
+		else if (x <= x1 && x + hor - 1 >= x0) {
+			// cell is clipped by the region, expand it aside and copy the visible part
+			int32_t start = x > x0 ? x : x0;
+			int32_t end = x + hor - 1 < x1 ? x + hor - 1 : x1;
+			packed_font_row(_font, glyph, row, cell, _colour, _background);
+			for (int32_t i = start; i <= end; i++)
+				line[i - x0] = cell[i - x];
+		}
+
+		x += glyph->advance;
+	}
+}
+
+Rect Text::getDirtyBounds() {
+	if (!_isDrawn)
+		return getBounds();
+
+	// cells of glyphs which changed or moved, plus cells of the old tail if the string got shorter
+	const std::string& str = _shownString();
+	int32_t glyphX[TEXT_MAX_GLYPHS + 1];
+	int count = _layout(str, glyphX);
+	Rect dirty { _x, _y, _x - 1, _y - 1 };
+
+	for (int i = _firstChangedGlyph(str, glyphX, count, 0); i < count || i < _drawnCount;
+		 i = _firstChangedGlyph(str, glyphX, count, i + 1)) {
+		if (i < count)
+			dirty = dirty.isEmpty() ? _cell(glyphX[i]) : dirty.merged(_cell(glyphX[i]));
+		if (i < _drawnCount)
+			dirty = dirty.isEmpty() ? _cell(_drawnGlyphX[i]) : dirty.merged(_cell(_drawnGlyphX[i]));
+	}
+
+	return dirty;
+}
+
+void Text::markClean() {
+	_drawnString = _shownString();
+	_drawnCount = _layout(_drawnString, _drawnGlyphX);
+	_isDrawn = true;
+}
+
+const std::string& Text::_shownString() {
+	return _visible ? _displayString : _defaultString;
+}
+
+int Text::_layout(const std::string& str, int32_t* glyphX) {
+	int32_t x = _x;
+	int count = 0;
+
+	// characters outside the font keep their index but don't advance, like SPI_TFT_ILI9341::character()
+	for (char c : str) {
+		if (count == TEXT_MAX_GLYPHS)
+			break;
+
+		const packed_glyph_t* glyph = packed_font_glyph(_font, c);
+		glyphX[count++] = x;
+		if (glyph != nullptr)
+			x += glyph->advance;
+	}
+
+	glyphX[count] = x;
+	return count;
+}
+
+int Text::_firstChangedGlyph(const std::string& str, const int32_t* glyphX, int count, int from) {
+	int i = from;
+
+	while (i < count && i < _drawnCount && str[i] == _drawnString[i] && glyphX[i] == _drawnGlyphX[i])
+		i++;
+
+	return i;
+}
+
+void Text::_drawString(const std::string& str) {
+	int32_t glyphX[TEXT_MAX_GLYPHS + 1];
+	int count = _layout(str, glyphX);
+	int first = _isDrawn ? _firstChangedGlyph(str, glyphX, count, 0) : 0;
+
+	// a glyph paints over the start of the next cell, so everything after the first change is redrawn
+	if (first < count) {
+		_tft->set_font(_font);
+		_tft->locate(glyphX[first], _y);
+		_tft->printf("%s", str.c_str() + first);
+	}
+
+	// clear the tail of a longer drawn string
+	if (_isDrawn && _drawnCount > count) {
+		int32_t end = count > 0 ? _cell(glyphX[count - 1]).x1 : _x - 1;
+		Rect tail = _cell(_drawnGlyphX[_drawnCount - 1]);
+		if (tail.x1 > end)
+			_tft->fillrect(end + 1, tail.y0, tail.x1, tail.y1, _background);
+	}
+
+	_drawnString = str;
+	_drawnCount = count;
+	for (int i = 0; i <= count; i++)
+		_drawnGlyphX[i] = glyphX[i];
+	_isDrawn = true;
+}
+
+Rect Text::_cell(int32_t x) {
+	return Rect { x, _y, x + _font->hor - 1, _y + _font->vert - 1 };
+}
@@ -5,18 +5,37 @@
 
 #include <string>
 
+#define TEXT_MAX_GLYPHS 16
+
 class Text : public Shape {
 	public:
 		~Text() { }
-		void init(SPI_TFT_ILI9341* tft, int32_t xpos, int32_t ypos, unsigned char* font, const std::string& defaultString);
+		void init(SPI_TFT_ILI9341* tft, int32_t xpos, int32_t ypos, const packed_font_t* font, const std::string& defaultString);
 		void draw() override;
 		void clear() override;
+		Rect getBounds() override;
+		void render(int32_t y, int32_t x0, int32_t x1, uint16_t* line) override;
+		Rect getDirtyBounds() override;
+		void markClean() override;
 		void setDisplayString(const std::string& value);
 
 	private:
-		unsigned char* _font;
+		const packed_font_t* _font;
 		std::string _displayString;
 		std::string _defaultString;
+		std::string _drawnString;						// string currently on screen
+		int32_t _drawnGlyphX[TEXT_MAX_GLYPHS + 1];		// x offset of each glyph of _drawnString
+		int _drawnCount = 0;
+		bool _isDrawn = false;
+
+		// string shown in the current state: display string when visible, default string when cleared
+		const std::string& _shownString();
+		// fills in the x offset of every character of str and returns the number of glyphs
+		int _layout(const std::string& str, int32_t* glyphX);
+		// index of the first glyph which differs from the drawn string
+		int _firstChangedGlyph(const std::string& str, const int32_t* glyphX, int count, int from);
+		void _drawString(const std::string& str);
+		Rect _cell(int32_t x);
 };
 
-#endif
\ No newline at end of file
+#endif
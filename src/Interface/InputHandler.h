@@ -1,8 +1,6 @@
 #ifndef _INPUT_HANDLER_H_
 #define _INPUT_HANDLER_H_
 
-#include <unordered_map>
-
 #include "util.h"
 #include "Input.h"
 
@@ -1,18 +1,19 @@
 #include "SteeringDisplay.h"
 
+#include <math.h>
+#include <stdint.h>
 #include <stdlib.h>
 
-#include "AnimationFlashing.h"
-#include "Arial12x12.h"
-#include "font_big.h"
+#include "Arial12x12_packed.h"
+#include "Neu42x35_packed.h"
 #include "graphics.h"
 
 /* Display Macros */
 // #define DISPLAY_RPM
 
 // fonts
-#define SMALL_FONT Arial12x12
-#define COOL_FONT Neu42x35
+#define SMALL_FONT Arial12x12_packed
+#define COOL_FONT Neu42x35_packed
 
 // accessories
 #define DMS_X 100
@@ -99,7 +100,11 @@
 #define ESHIFT_BOX_Y 83
 #define ESHIFT_BOX_Y_HEIGHT 40
 
-SteeringDisplay::SteeringDisplay(SPI_TFT_ILI9341* tft) : _tft(tft) {
+SteeringDisplay::SteeringDisplay(SPI_TFT_ILI9341* tft) : _tft(tft), _dirtyGraphics(0), _changes(&_wakeFlags, DISPLAY_WAKE_FLAG) {
+    static_assert(DynamicGraphicCount <= 32, "one dirty bit per dynamic graphic");
+    for (int id = 0; id < DynamicGraphicCount; id++) {
+        _pendingVisible[id] = true;
+    }
     _animationTimer.start();
 }
 
@@ -108,9 +113,10 @@ void SteeringDisplay::init() {
     _tft->set_orientation(3);
     _tft->background(Black);
     _tft->cls();
+    _compositor.init(_tft, Black);
 
     /* Small Font Graphics */
-    _tft->set_font((unsigned char*)SMALL_FONT);
+    _tft->set_font(&SMALL_FONT);
 
     // Dms
     _tft->locate(DMS_X, STATUS_Y);
@@ -137,9 +143,9 @@ void SteeringDisplay::init() {
                       Green, BATTERY_RIGHT_X - BATTERY_PADDING, BATTERY_RIGHT_Y - BATTERY_PADDING, true);
     _setDynamicGraphic(SteeringDisplay::Battery, &_batteryIcon);
     // Battery Soc
-    _initializeDynamicText(&_batterySocText, SteeringDisplay::Soc, BATTERY_TEXT_X, SOC_TEXT_Y, (unsigned char*)SMALL_FONT, "00.0 %%");
+    _initializeDynamicText(&_batterySocText, SteeringDisplay::Soc, BATTERY_TEXT_X, SOC_TEXT_Y, &SMALL_FONT, "00.0 %");
     // Battery Voltage
-    _initializeDynamicText(&_batteryVoltageText, SteeringDisplay::Voltage, BATTERY_TEXT_X, VOLTAGE_TEXT_Y, (unsigned char*)SMALL_FONT, "00.0 V");
+    _initializeDynamicText(&_batteryVoltageText, SteeringDisplay::Voltage, BATTERY_TEXT_X, VOLTAGE_TEXT_Y, &SMALL_FONT, "00.0 V");
 
     // Cool Font Graphics Labels
     _tft->locate(SPEED_X_LABEL, SPEED_Y_LABEL);
@@ -154,137 +160,131 @@ void SteeringDisplay::init() {
     #endif
 
     /* Cool Font Graphics */
-    _tft->set_font((unsigned char*)COOL_FONT);
+    _tft->set_font(&COOL_FONT);
 
     // Speed
     _tft->locate(SPEED_X + SPEED_X_UNIT_OFFSET, SPEED_Y);
     _tft->printf("K/H");
-    _initializeDynamicText(&_speedText, SteeringDisplay::Speed, SPEED_X, SPEED_Y, (unsigned char*)COOL_FONT, "00");
+    _initializeDynamicText(&_speedText, SteeringDisplay::Speed, SPEED_X, SPEED_Y, &COOL_FONT, "00");
 
     // Throttle
     _tft->locate(POWER_X + POWER_X_UNIT_OFFSET, POWER_Y);
     _tft->printf("%%");
-    _initializeDynamicText(&_powerText, SteeringDisplay::Power, POWER_X, POWER_Y, (unsigned char*)COOL_FONT, "000");
+    _initializeDynamicText(&_powerText, SteeringDisplay::Power, POWER_X, POWER_Y, &COOL_FONT, "000");
 
     // Rpm
     #ifdef DISPLAY_RPM
     // _tft->locate(RPM_X + RPM_X_UNIT_OFFSET, RPM_Y);
     // _tft->printf("RPM");
-    // _initializeDynamicText(&_rpmText, SteeringDisplay::Rpm, RPM_X, RPM_Y, (unsigned char*)COOL_FONT, "0000");
+    // _initializeDynamicText(&_rpmText, SteeringDisplay::Rpm, RPM_X, RPM_Y, &COOL_FONT, "0000");
     #endif
 
     // EShift
     _tft->rect(ESHIFT_BOX_X, ESHIFT_BOX_Y, ESHIFT_BOX_X + ESHIFT_BOX_X_WIDTH, ESHIFT_BOX_Y + ESHIFT_BOX_Y_HEIGHT, White);
     _tft->locate(ESHIFT_X - ESHIFT_X_UNIT_OFFSET, ESHIFT_Y);
     _tft->printf("S");
-    _initializeDynamicText(&_eShiftText, SteeringDisplay::eShift, ESHIFT_X, ESHIFT_Y, (unsigned char*)COOL_FONT, "1");
+    _initializeDynamicText(&_eShiftText, SteeringDisplay::eShift, ESHIFT_X, ESHIFT_Y, &COOL_FONT, "1");
 
     // Time
     _tft->locate(COLON_X, TIME_Y);
     _tft->printf(":");
-    _initializeDynamicText(&_timeTextMinutes, SteeringDisplay::Minutes, MINUTES_X, TIME_Y, (unsigned char*)COOL_FONT, "00");
-    _initializeDynamicText(&_timeTextSeconds, SteeringDisplay::Seconds, SECONDS_X, TIME_Y, (unsigned char*)COOL_FONT, "00");
+    _initializeDynamicText(&_timeTextMinutes, SteeringDisplay::Minutes, MINUTES_X, TIME_Y, &COOL_FONT, "00");
+    _initializeDynamicText(&_timeTextSeconds, SteeringDisplay::Seconds, SECONDS_X, TIME_Y, &COOL_FONT, "00");
 
     /* Bitmap Graphics */
 
     // Headlights
     _lights.init(_tft, LIGHTS_X, LIGHTS_Y, LIGHTS_WIDTH, LIGHTS_HEIGHT, graphicLights);
-    _dynamicGraphics[SteeringDisplay::Lights] = &_lights;
+    _dynamicGraphics.set(SteeringDisplay::Lights, &_lights);
+    _compositor.addLayer(&_lights);
     // Left Signal
     _leftSignal.init(_tft, TURN_LEFT_X, TURN_LEFT_Y, TURN_WIDTH, TURN_HEIGHT, graphicLeftArrow);
-    _dynamicGraphics[SteeringDisplay::LeftSignal] = &_leftSignal;
+    _dynamicGraphics.set(SteeringDisplay::LeftSignal, &_leftSignal);
+    _compositor.addLayer(&_leftSignal);
     // Right Signal
     _rightSignal.init(_tft, TURN_RIGHT_X, TURN_RIGHT_Y, TURN_WIDTH, TURN_HEIGHT, graphicRightArrow);
-    _dynamicGraphics[SteeringDisplay::RightSignal] = &_rightSignal;
+    _dynamicGraphics.set(SteeringDisplay::RightSignal, &_rightSignal);
+    _compositor.addLayer(&_rightSignal);
 
     _runRedrawQueue();
 }
 
 void SteeringDisplay::run() {
+    // property listeners queue the redraws and animations handled below
+    _changes.dispatch(_animationMillis());
+
     _runRedrawQueue();
 
-    // run action queue
-    while (!_actionQueue.empty()) {
-        auto& action = _actionQueue.front();
-        _actionQueue.pop();
-        (action)();
+    _runAnimationQueue();
+
+    // step the time-based animations which are due
+    _animations.run(_animationMillis());
+
+    int64_t nextDeadline = _animations.nextDeadline();
+    if (_changes.nextDeadline() < nextDeadline)
+        nextDeadline = _changes.nextDeadline();
+    _waitForWork(nextDeadline);
+}
+
+void SteeringDisplay::_waitForWork(int64_t nextDeadline) {
+    // work posted since the queues were drained leaves the flag set, so nothing is missed between the two
+    if (nextDeadline == INT64_MAX) {
+        _wakeFlags.wait_any(DISPLAY_WAKE_FLAG);
+        return;
     }
 
-    // run time-based animations
-    int64_t currentTime = std::chrono::duration_cast<std::chrono::milliseconds>(_animationTimer.elapsed_time()).count();
-    for (const auto& pair : _animations)
-        pair.second->run(currentTime);
+    int64_t timeout = nextDeadline - _animationMillis();
+    if (timeout > 0)
+        _wakeFlags.wait_any_for(DISPLAY_WAKE_FLAG, Kernel::Clock::duration_u32(timeout));
+}
+
+int64_t SteeringDisplay::_animationMillis() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(_animationTimer.elapsed_time()).count();
+}
+
+void SteeringDisplay::_requestRedraw(DynamicGraphicId id, bool visible) {
+    // any number of requests for one id between two frames collapse into a single draw
+    // only called on the display thread before _runRedrawQueue(), so there is no one to wake
+    _pendingVisible[id].store(visible, std::memory_order_relaxed);
+    _dirtyGraphics.fetch_or(1u << id, std::memory_order_release);
 }
 
 void SteeringDisplay::_runRedrawQueue() {
-    while (!_redrawActionQueue.empty()) {
-        RedrawAction action = _redrawActionQueue.front();
-        _redrawActionQueue.pop();
-        (action.shape->*action.method)();
+    // collect damage from all dirty graphics, then paint every damaged region once
+    uint32_t dirty = _dirtyGraphics.exchange(0, std::memory_order_acquire);
+    for (int id = 0; dirty != 0; id++, dirty >>= 1) {
+        Shape* shape = _getDynamicGraphic((DynamicGraphicId)id);
+        if (!(dirty & 1) || shape == nullptr)
+            continue;
+        shape->setVisible(_pendingVisible[id].load(std::memory_order_relaxed));
+        _compositor.invalidate(shape);
     }
+
+    _compositor.flush();
 }
 
-Command* SteeringDisplay::_getDelegateForGraphicId(SteeringDisplay::DynamicGraphicId id) {
-    switch (id) {
-        case SteeringDisplay::Dms:
-            return new Delegate<SteeringDisplay, data_t>(this, &SteeringDisplay::_onDmsChanged);
-            break;
-        case SteeringDisplay::Ignition:
-            return new Delegate<SteeringDisplay, data_t>(this, &SteeringDisplay::_onIgnitionChanged);
-            break;
-        case SteeringDisplay::Brake:
-            return new Delegate<SteeringDisplay, data_t>(this, &SteeringDisplay::_onBrakeChanged);
-            break;
-        case SteeringDisplay::Battery:
-            // Battery icon is updated with new soc / voltage data
-            break;
-        case SteeringDisplay::Soc:
-            return new Delegate<SteeringDisplay, batt_t>(this, &SteeringDisplay::_onBatterySocChanged);
-            break;
-        case SteeringDisplay::Voltage:
-            return new Delegate<SteeringDisplay, batt_t>(this, &SteeringDisplay::_onVoltageChanged);
-            break;
-        case SteeringDisplay::eShift:
-            return new Delegate<SteeringDisplay, eshift_t>(this, &SteeringDisplay::_onEShiftChanged);
-            break;
-        case SteeringDisplay::Speed:
-            return new Delegate<SteeringDisplay, speed_t>(this, &SteeringDisplay::_onSpeedChanged);
-            break;
-        case SteeringDisplay::Power:
-            return new Delegate<SteeringDisplay, throttle_t>(this, &SteeringDisplay::_onPowerChanged);
-            break;
-        case SteeringDisplay::Rpm:
-            return new Delegate<SteeringDisplay,rpm_t>(this, &SteeringDisplay::_onRpmChanged);
-            break;
-        case SteeringDisplay::Lights:
-            return new Delegate<SteeringDisplay, data_t>(this, &SteeringDisplay::_onLightsChanged);
-            break;
-        case SteeringDisplay::LeftSignal:
-            return new Delegate<SteeringDisplay, data_t>(this, &SteeringDisplay::_onLeftSignalChanged);
-            break;
-        case SteeringDisplay::RightSignal:
-            return new Delegate<SteeringDisplay, data_t>(this, &SteeringDisplay::_onRightSignalChanged);
-            break;
-        case SteeringDisplay::Minutes:
-            return new Delegate<SteeringDisplay, steering_time_t>(this, &SteeringDisplay::_onTimeChanged);
-            break;
-        case SteeringDisplay::Hazards:
-            return new Delegate<SteeringDisplay, data_t>(this, &SteeringDisplay::_onBlinkChanged);
-            break;
-        default:
-            // do nothing
-            break;
+void SteeringDisplay::_runAnimationQueue() {
+    AnimationAction action;
+    while (_animationQueue.tryPop(action)) {
+        if (action.terminate)
+            _animations.stop(action.id);
+        else
+            _animations.start(action.id, _getDynamicGraphic(action.id), TURN_FLASHING_INTERVAL);
     }
+}
 
-    return nullptr;
+Shape* SteeringDisplay::_getDynamicGraphic(DynamicGraphicId id) {
+    Shape** shape = _dynamicGraphics.find(id);
+    return shape != nullptr ? *shape : nullptr;
 }
 
 void SteeringDisplay::_setDynamicGraphic(DynamicGraphicId id, Shape* shape) {
-    _dynamicGraphics[id] = shape;
-    _redrawActionQueue.push(RedrawAction{shape, &Shape::draw});
+    _dynamicGraphics.set(id, shape);
+    _compositor.addLayer(shape);
+    _requestRedraw(id);
 }
 
-void SteeringDisplay::_initializeDynamicText(Text* textField, SteeringDisplay::DynamicGraphicId id, int32_t xpos, int32_t ypos, unsigned char* font, std::string str) {
+void SteeringDisplay::_initializeDynamicText(Text* textField, SteeringDisplay::DynamicGraphicId id, int32_t xpos, int32_t ypos, const packed_font_t* font, std::string str) {
     textField->init(_tft, xpos, ypos, font, str);
     _setDynamicGraphic(id, textField);
 }
@@ -302,13 +302,13 @@ void SteeringDisplay::_onBrakeChanged(const data_t value) {
 }
 
 void SteeringDisplay::_onBatterySocChanged(const batt_t value) {
-    _updateTextField(SteeringDisplay::Soc, _batteryDataToString(value));
+    _updateTextField(SteeringDisplay::Soc, _batteryDataToString(value, " %"));
     _batteryIcon.scale(value);
-    _redrawActionQueue.push(RedrawAction{&_batteryIcon, &Shape::draw});
+    _requestRedraw(SteeringDisplay::Battery);
 }
 
 void SteeringDisplay::_onVoltageChanged(const batt_t value) {
-    _updateTextField(SteeringDisplay::Voltage, _batteryDataToString(value));
+    _updateTextField(SteeringDisplay::Voltage, _batteryDataToString(value, " V"));
 }
 
 void SteeringDisplay::_onEShiftChanged(const eshift_t value) {
@@ -336,14 +336,7 @@ void SteeringDisplay::_onRpmChanged(const rpm_t value){
 }
 
 void SteeringDisplay::_onLightsChanged(const data_t value) {
-    RedrawAction action{&_lights, 0x0};
-
-    if (value)
-        action.method = &Shape::draw;
-    else
-        action.method = &Shape::clear;
-
-    _redrawActionQueue.push(action);
+    _requestRedraw(SteeringDisplay::Lights, value);
 }
 
 void SteeringDisplay::_onLeftSignalChanged(const data_t value) {
@@ -355,20 +348,8 @@ void SteeringDisplay::_onRightSignalChanged(const data_t value) {
 }
 
 void SteeringDisplay::_onBlinkChanged(const data_t value) {
-	RedrawAction action_left { &_leftSignal, 0x0 };
-	RedrawAction action_right { &_rightSignal, 0x0 };
-
-	if (value){
-		action_left.method = &Shape::draw;
-		action_right.method = &Shape::draw;
-	}
-	else{
-		action_left.method = &Shape::clear;
-		action_right.method = &Shape::clear;
-	}
-
-	_redrawActionQueue.push(action_left);
-	_redrawActionQueue.push(action_right);
+	_requestRedraw(SteeringDisplay::LeftSignal, value);
+	_requestRedraw(SteeringDisplay::RightSignal, value);
 }
 
 void SteeringDisplay::_onTimeChanged(const steering_time_t value) {
@@ -387,37 +368,27 @@ void SteeringDisplay::_onTimeChanged(const steering_time_t value) {
 }
 
 void SteeringDisplay::_updateCircleIcon(DynamicGraphicId id, data_t value) {
-    auto& circle = _dynamicGraphics[id];
+    Shape* circle = _getDynamicGraphic(id);
     circle->setColour(int32_t(value ? Green : Red));
-    _redrawActionQueue.push(RedrawAction{circle, &Shape::draw});
+    _requestRedraw(id);
 }
 
 void SteeringDisplay::_updateTextField(DynamicGraphicId id, const std::string& value) {
-    auto& shape = _dynamicGraphics[id];
+    Shape* shape = _getDynamicGraphic(id);
     ((Text*)shape)->setDisplayString(value);
-    _redrawActionQueue.push(RedrawAction{shape, &Shape::draw});
+    _requestRedraw(id);
 }
 
-const std::string SteeringDisplay::_batteryDataToString(const batt_t value) {
-    char buf[6] = {};
-    uint8_t decimal = (uint16_t)(value * 10) % 10;
-    sprintf(buf, "%02d.%d", (uint8_t)value, decimal);
+const std::string SteeringDisplay::_batteryDataToString(const batt_t value, const char* unit) {
+    // unit is part of the string: text fields only redraw changed glyphs and clear what's left of the old string
+    // rounded to tenths, the same steps the battery change policy compares
+    char buf[9] = {};
+    int tenths = (int)lround(value * 10);
+    snprintf(buf, sizeof(buf), "%02d.%d%s", tenths / 10, tenths % 10, unit);
     return std::string(buf);
 }
 
 void SteeringDisplay::_handleAnimationChanged(DynamicGraphicId id, bool terminate) {
-    if (terminate)
-        _actionQueue.push([this, id]() -> void {
-            if (_animations.find(id) != _animations.end()) {
-                Animation* toDelete = _animations[id];
-                toDelete->stop();
-                _animations.erase(id);
-                delete toDelete;
-            }
-        });
-    else
-        _actionQueue.push([this, id]() -> void {
-            if (_animations.find(id) == _animations.end())
-                _animations[id] = new AnimationFlashing(_dynamicGraphics[id], TURN_FLASHING_INTERVAL);
-        });
+    // animations are owned by the ui thread, it starts / stops them in run() right after the listeners
+    _animationQueue.tryPush(AnimationAction{id, terminate});
 }
@@ -1,8 +1,8 @@
 #ifndef _STEERING_DISPLAY_H_
 #define _STEERING_DISPLAY_H_
 
-#include <mstd_functional>
-#include <unordered_map>
+#include <atomic>
+#include <type_traits>
 #include <mbed.h>
 
 #include "Mutex.h"
@@ -10,38 +10,60 @@
 #include "util.h"
 #include "data-types.h"
 
+#include "ChangeDispatcher.h"
+#include "FixedMap.h"
 #include "SharedProperty.h"
-#include "ThreadedQueue.h"
+#include "LockFreeQueue.h"
 #include "Circle.h"
 #include "Rectangle.h"
 #include "ScalableRectangle.h"
 #include "Text.h"
 #include "Bitmap.h"
 #include "CompositeShape.h"
-#include "Animation.h"
+#include "AnimationScheduler.h"
+#include "Compositor.h"
 
 using namespace util;
 
 #define DEBUG_THROTTLE 0
+#define ANIMATION_QUEUE_SIZE 8
+#define DISPLAY_WAKE_FLAG 0x1
 
 class SteeringDisplay {
 	public:
-		enum DynamicGraphicId { Dms, Ignition, Brake, Battery, Soc, Voltage, eShift, Speed, Power, Rpm, Lights, LeftSignal, RightSignal, Minutes, Seconds, Hazards };
+		enum DynamicGraphicId { Dms, Ignition, Brake, Battery, Soc, Voltage, eShift, Speed, Power, Rpm, Lights, LeftSignal, RightSignal, Minutes, Seconds, Hazards, DynamicGraphicCount };
 		SteeringDisplay(SPI_TFT_ILI9341* tft);
 		~SteeringDisplay() { }
 		void init();
+
+		/**
+		 * @brief draws pending changes and animation steps, then blocks until there is new work or the next
+		 * animation is due
+		 */
 		void run();
 
-		template <class T>
-		void addDynamicGraphicBinding(SharedProperty<T>& property, DynamicGraphicId id) {
-			Command* command = _getDelegateForGraphicId(id);
-			property.addValueChangedListener(command);
+		/**
+		 * @brief redraws graphic Id whenever property changes as far as policy is concerned
+		 *
+		 * The handler of Id is picked at compile time (see GraphicHandler below), binding a property whose type
+		 * doesn't match it or an id without one fails to compile.
+		 */
+		template <DynamicGraphicId Id, class T>
+		void addDynamicGraphicBinding(SharedProperty<T>& property, const ChangePolicy& policy = ChangePolicy()) {
+			static_assert(std::is_same<T, typename GraphicHandler<Id>::type>::value, "property type doesn't match the graphic's handler");
+			// the ui work of a change (formatting, layout) runs on the display thread, not in the setter's
+			property.addValueChangedListener(GraphicHandler<Id>::bind(this));
+			property.dispatchOn(_changes, policy);
 		}
 
 	private:
-		struct RedrawAction {
-			Shape* shape;
-			void (Shape::*method)(void);
+		// value type and data changed callback of each bindable dynamic graphic
+		template <DynamicGraphicId Id>
+		struct GraphicHandler;
+
+		struct AnimationAction {
+			DynamicGraphicId id;
+			bool terminate;
 		};
 
 		struct InternalAction {
@@ -50,10 +72,14 @@ class SteeringDisplay {
 		};
 
 		SPI_TFT_ILI9341* _tft;
-		std::unordered_map<DynamicGraphicId, Shape*> _dynamicGraphics;	// id (as index) to dynamic graphics map
-		std::unordered_map<DynamicGraphicId, Animation*> _animations;	// graphic id to timed animation map
-		ThreadedQueue<RedrawAction> _redrawActionQueue;					// queue of actions: main thread adds to this, ui thread executes
-		ThreadedQueue<std::function<void(void)>> _actionQueue;			// queue of generic functions (can include lambdas with captures)
+		FixedMap<DynamicGraphicId, Shape*, DynamicGraphicCount> _dynamicGraphics;	// id (as index) to dynamic graphics map
+		AnimationScheduler _animations;									// timed animations keyed by graphic id, next due first
+		std::atomic<uint32_t> _dirtyGraphics;							// bit per id: listeners set, ui thread takes them all at once
+		std::atomic<bool> _pendingVisible[DynamicGraphicCount];			// latest visibility requested per id, only the last one is drawn
+		LockFreeQueue<AnimationAction, ANIMATION_QUEUE_SIZE> _animationQueue;		// animations to start / stop, same threads
+		Compositor _compositor;											// repaints regions damaged by the redraw queue once per run
+		EventFlags _wakeFlags;											// set by _changes when another thread changes a bound property
+		ChangeDispatcher _changes;										// bound properties which changed since the last run
 		Timer _animationTimer;											// timer for animations to keep track of their states
 		steering_time_t _lastTime;
 		// Dynamic Graphics (these are bound to external shared properties)
@@ -73,12 +99,17 @@ class SteeringDisplay {
 		Bitmap _leftSignal;
 		Bitmap _rightSignal;
 		
+		void _requestRedraw(DynamicGraphicId id, bool visible = true);
 		void _runRedrawQueue();
+		void _runAnimationQueue();
+		void _waitForWork(int64_t nextDeadline);
+		int64_t _animationMillis();
+
+		Shape* _getDynamicGraphic(DynamicGraphicId id);
 
 		// Initialization helpers
-		Command* _getDelegateForGraphicId(DynamicGraphicId id);
 		void _setDynamicGraphic(DynamicGraphicId id, Shape* shape);
-		void _initializeDynamicText(Text* textField, DynamicGraphicId id, int32_t xpos, int32_t ypos, unsigned char* font, std::string str);
+		void _initializeDynamicText(Text* textField, DynamicGraphicId id, int32_t xpos, int32_t ypos, const packed_font_t* font, std::string str);
 
 		// Data changed event callbacks (these are latched to relevant property changed events)
 		void _onDmsChanged(const data_t value);
@@ -99,9 +130,35 @@ class SteeringDisplay {
 		// Data changed helpers
 		void _updateCircleIcon(DynamicGraphicId id, data_t value);
 		void _updateTextField(DynamicGraphicId id, const std::string& value);
-		const std::string _batteryDataToString(const batt_t value);
+		const std::string _batteryDataToString(const batt_t value, const char* unit);
 		void _handleAnimationChanged(DynamicGraphicId id, bool value);
 
 };
 
+#define GRAPHIC_HANDLER(id, T, callback) \
+	template <> \
+	struct SteeringDisplay::GraphicHandler<SteeringDisplay::id> { \
+		typedef T type; \
+		static Listener<T> bind(SteeringDisplay* display) { \
+			return Listener<T>::template bind<SteeringDisplay, &SteeringDisplay::callback>(display); \
+		} \
+	};
+
+GRAPHIC_HANDLER(Dms, data_t, _onDmsChanged)
+GRAPHIC_HANDLER(Ignition, data_t, _onIgnitionChanged)
+GRAPHIC_HANDLER(Brake, data_t, _onBrakeChanged)
+GRAPHIC_HANDLER(Soc, batt_t, _onBatterySocChanged)			// also updates the battery icon
+GRAPHIC_HANDLER(Voltage, batt_t, _onVoltageChanged)
+GRAPHIC_HANDLER(eShift, eshift_t, _onEShiftChanged)
+GRAPHIC_HANDLER(Speed, speed_t, _onSpeedChanged)
+GRAPHIC_HANDLER(Power, throttle_t, _onPowerChanged)
+GRAPHIC_HANDLER(Rpm, rpm_t, _onRpmChanged)
+GRAPHIC_HANDLER(Lights, data_t, _onLightsChanged)
+GRAPHIC_HANDLER(LeftSignal, data_t, _onLeftSignalChanged)
+GRAPHIC_HANDLER(RightSignal, data_t, _onRightSignalChanged)
+GRAPHIC_HANDLER(Minutes, steering_time_t, _onTimeChanged)		// also updates the seconds
+GRAPHIC_HANDLER(Hazards, data_t, _onBlinkChanged)
+
+#undef GRAPHIC_HANDLER
+
 #endif
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include "AdcScanner.h"
+
+#include "pinmap.h"
+#include "PeripheralPins.h"
+
+// the hal callbacks carry no context, there's only one ADC1 anyway
+static AdcScanner* s_scanner = nullptr;
+
+static const uint32_t s_ranks[ADC_SCAN_MAX_CHANNELS] = {
+	ADC_REGULAR_RANK_1, ADC_REGULAR_RANK_2, ADC_REGULAR_RANK_3, ADC_REGULAR_RANK_4
+};
+
+static const uint32_t s_ratios[] = {
+	ADC_OVERSAMPLING_RATIO_2, ADC_OVERSAMPLING_RATIO_4, ADC_OVERSAMPLING_RATIO_8, ADC_OVERSAMPLING_RATIO_16,
+	ADC_OVERSAMPLING_RATIO_32, ADC_OVERSAMPLING_RATIO_64, ADC_OVERSAMPLING_RATIO_128, ADC_OVERSAMPLING_RATIO_256
+};
+
+static const uint32_t s_shifts[] = {
+	ADC_RIGHTBITSHIFT_NONE, ADC_RIGHTBITSHIFT_1, ADC_RIGHTBITSHIFT_2, ADC_RIGHTBITSHIFT_3, ADC_RIGHTBITSHIFT_4
+};
+
+AdcScanner::AdcScanner(const PinName* pins, int count, int oversampling, int decimation, int filterShift) :
+	_adc(), _dma(),
+	_count(count < ADC_SCAN_MAX_CHANNELS ? count : ADC_SCAN_MAX_CHANNELS),
+	_oversampling(oversampling < 0 ? 0 : (oversampling > 8 ? 8 : oversampling)),
+	_decimation(decimation < 1 ? 1 : (decimation > ADC_SCAN_MAX_DECIMATION ? ADC_SCAN_MAX_DECIMATION : decimation)),
+	_filterShift(filterShift),
+	_updates(0),
+	_publishedUs(0) {
+	for (int i = 0; i < _count; i++) {
+		// same pin lookup as AnalogIn, switches the pin to analog mode
+		uint32_t function = pinmap_function(pins[i], PinMap_ADC);
+		pinmap_pinout(pins[i], PinMap_ADC);
+		_channels[i] = __LL_ADC_DECIMAL_NB_TO_CHANNEL(STM_PIN_CHANNEL(function));
+		_filters[i] = 0;
+		_values[i] = 0;
+	}
+}
+
+void AdcScanner::start() {
+	s_scanner = this;
+
+	__HAL_RCC_ADC_CLK_ENABLE();
+	__HAL_RCC_DMA1_CLK_ENABLE();
+
+	// 12 bit samples summed 2^oversampling times: the hardware shifts sums wider than 16 bits back down
+	int hardwareShift = _oversampling > 4 ? _oversampling - 4 : 0;
+
+	_adc.Instance = ADC1;
+	_adc.Init.ClockPrescaler = ADC_CLOCK_SYNC_PCLK_DIV4;
+	_adc.Init.Resolution = ADC_RESOLUTION_12B;
+	_adc.Init.DataAlign = ADC_DATAALIGN_RIGHT;
+	_adc.Init.ScanConvMode = ADC_SCAN_ENABLE;
+	_adc.Init.EOCSelection = ADC_EOC_SEQ_CONV;
+	_adc.Init.LowPowerAutoWait = DISABLE;
+	_adc.Init.ContinuousConvMode = ENABLE;
+	_adc.Init.NbrOfConversion = _count;
+	_adc.Init.DiscontinuousConvMode = DISABLE;
+	_adc.Init.ExternalTrigConv = ADC_SOFTWARE_START;
+	_adc.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_NONE;
+	_adc.Init.DMAContinuousRequests = ENABLE;
+	_adc.Init.Overrun = ADC_OVR_DATA_OVERWRITTEN;
+	_adc.Init.OversamplingMode = _oversampling > 0 ? ENABLE : DISABLE;
+	_adc.Init.Oversampling.Ratio = s_ratios[_oversampling > 0 ? _oversampling - 1 : 0];
+	_adc.Init.Oversampling.RightBitShift = s_shifts[hardwareShift];
+	_adc.Init.Oversampling.TriggeredMode = ADC_TRIGGEREDMODE_SINGLE_TRIGGER;
+	_adc.Init.Oversampling.OversamplingStopReset = ADC_REGOVERSAMPLING_CONTINUED_MODE;
+	HAL_ADC_Init(&_adc);
+	HAL_ADCEx_Calibration_Start(&_adc, ADC_SINGLE_ENDED);
+
+	for (int i = 0; i < _count; i++) {
+		ADC_ChannelConfTypeDef config = {};
+		config.Channel = _channels[i];
+		config.Rank = s_ranks[i];
+		config.SamplingTime = ADC_SAMPLETIME_247CYCLES_5;
+		config.SingleDiff = ADC_SINGLE_ENDED;
+		config.OffsetNumber = ADC_OFFSET_NONE;
+		config.Offset = 0;
+		HAL_ADC_ConfigChannel(&_adc, &config);
+	}
+
+	_dma.Instance = DMA1_Channel1;
+	_dma.Init.Request = DMA_REQUEST_0;
+	_dma.Init.Direction = DMA_PERIPH_TO_MEMORY;
+	_dma.Init.PeriphInc = DMA_PINC_DISABLE;
+	_dma.Init.MemInc = DMA_MINC_ENABLE;
+	_dma.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+	_dma.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+	_dma.Init.Mode = DMA_CIRCULAR;
+	_dma.Init.Priority = DMA_PRIORITY_MEDIUM;
+	HAL_DMA_Init(&_dma);
+	__HAL_LINKDMA(&_adc, DMA_Handle, _dma);
+
+	NVIC_SetVector(DMA1_Channel1_IRQn, (uint32_t)&AdcScanner::_dmaIrq);
+	NVIC_EnableIRQ(DMA1_Channel1_IRQn);
+
+	HAL_ADC_Start_DMA(&_adc, (uint32_t*)_buffer, 2 * _decimation * _count);
+}
+
+uint16_t AdcScanner::sample(int channel) const {
+	int length = 2 * _decimation * _count;
+	// the dma counts down the transfers left until it wraps: step back from the scan it's writing to the one before
+	int written = length - (int)__HAL_DMA_GET_COUNTER(&_dma);
+	int scan = (written / _count) * _count - _count;
+	if (scan < 0)
+		scan += length;
+
+	return _buffer[scan + channel] << _scale();
+}
+
+int AdcScanner::_scale() const {
+	// sums of 2^oversampling 12 bit samples, at most 16 bits wide after the hardware shift
+	return _oversampling < 4 ? 4 - _oversampling : 0;
+}
+
+void AdcScanner::_onBlock(const uint16_t* block) {
+	int scale = _scale();
+
+	for (int i = 0; i < _count; i++) {
+		int32_t sum = 0;
+		for (int scan = 0; scan < _decimation; scan++)
+			sum += block[scan * _count + i];
+
+		int32_t sample = ((sum << scale) / _decimation) << 8;
+		_filters[i] += (sample - _filters[i]) >> _filterShift;
+		_values[i].store((uint16_t)(_filters[i] >> 8), std::memory_order_relaxed);
+	}
+	_publishedUs.store(us_ticker_read(), std::memory_order_relaxed);
+	_updates.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AdcScanner::_dmaIrq() {
+	HAL_DMA_IRQHandler(&s_scanner->_dma);
+}
+
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef* hadc) {
+	if (s_scanner != nullptr && hadc == &s_scanner->_adc)
+		s_scanner->_onBlock(s_scanner->_buffer);
+}
+
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef* hadc) {
+	if (s_scanner != nullptr && hadc == &s_scanner->_adc)
+		s_scanner->_onBlock(s_scanner->_buffer + s_scanner->_decimation * s_scanner->_count);
+}
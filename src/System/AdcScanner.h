@@ -0,0 +1,89 @@
+#ifndef _ADC_SCANNER_H_
+#define _ADC_SCANNER_H_
+
+#include <atomic>
+#include <mbed.h>
+
+#if !defined(TARGET_STM32L4)
+#error "AdcScanner drives the STM32L4 ADC and DMA registers directly"
+#endif
+
+#define ADC_SCAN_MAX_CHANNELS 4
+#define ADC_SCAN_MAX_DECIMATION 16
+
+/**
+ * @brief Background ADC sequencer: ADC1 converts a list of pins over and over while DMA1 moves the results into
+ * a circular buffer, the CPU is only involved twice per buffer
+ *
+ * Every conversion is oversampled in hardware (2^oversampling samples summed), every half of the DMA buffer holds
+ * `decimation` scans which are averaged into one value per channel, and that value goes through a first order
+ * low pass (new = old + (sample - old) / 2^filterShift). Results are 16 bit fixed point like AnalogIn::read_u16()
+ * and can be read at any time without blocking.
+ *
+ * Takes over ADC1 completely: don't use AnalogIn next to it.
+ */
+class AdcScanner {
+	public:
+		/**
+		 * @param pins analog pins to scan, at most ADC_SCAN_MAX_CHANNELS
+		 * @param oversampling log2 of the hardware oversampling ratio (0 .. 8)
+		 * @param decimation scans averaged per published value (1 .. ADC_SCAN_MAX_DECIMATION)
+		 * @param filterShift low pass strength, 0 publishes the plain averages
+		 */
+		AdcScanner(const PinName* pins, int count, int oversampling, int decimation, int filterShift);
+		~AdcScanner() { }
+
+		/**
+		 * @brief configures ADC and DMA and starts the continuous scan
+		 */
+		void start();
+
+		/**
+		 * @brief latest filtered value of a channel (0 .. 0xFFFF)
+		 */
+		uint16_t value(int channel) const { return _values[channel].load(std::memory_order_relaxed); }
+
+		/**
+		 * @brief unfiltered value of a channel from the last complete scan (0 .. 0xFFFF), for callers which need a
+		 * sample that is at most two scan times old rather than a smooth one
+		 */
+		uint16_t sample(int channel) const;
+
+		/**
+		 * @brief latest filtered value of a channel (0.0 .. 1.0)
+		 */
+		float read(int channel) const { return value(channel) * (1.0f / 0xFFFF); }
+
+		/**
+		 * @brief number of values published per channel so far
+		 */
+		uint32_t updates() const { return _updates.load(std::memory_order_relaxed); }
+
+		/**
+		 * @brief us_ticker time the latest values were published, i.e. the end of the scans they were averaged from
+		 */
+		uint32_t publishedUs() const { return _publishedUs.load(std::memory_order_relaxed); }
+
+	private:
+		ADC_HandleTypeDef _adc;
+		DMA_HandleTypeDef _dma;
+		uint32_t _channels[ADC_SCAN_MAX_CHANNELS];		// hal channel numbers in scan order
+		int _count;
+		int _oversampling;
+		int _decimation;
+		int _filterShift;
+		uint16_t _buffer[2 * ADC_SCAN_MAX_DECIMATION * ADC_SCAN_MAX_CHANNELS];
+		int32_t _filters[ADC_SCAN_MAX_CHANNELS];		// low pass states, 8 more fraction bits than the values
+		std::atomic<uint16_t> _values[ADC_SCAN_MAX_CHANNELS];
+		std::atomic<uint32_t> _updates;
+		std::atomic<uint32_t> _publishedUs;
+
+		int _scale() const;
+		void _onBlock(const uint16_t* block);
+		static void _dmaIrq();
+
+		friend void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef* hadc);
+		friend void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef* hadc);
+};
+
+#endif
@@ -0,0 +1,135 @@
+#include "BufferedCAN.h"
+
+static const uint32_t s_mailboxEmpty[CAN_TX_MAILBOXES] = { CAN_TSR_TME0, CAN_TSR_TME1, CAN_TSR_TME2 };
+
+BufferedCAN::BufferedCAN(PinName rd, PinName td, int hz) : CAN(rd, td, hz), _txHeld(false), _subscriptionCount(0), _overruns(0) {
+	for (int i = 0; i < CAN_TX_MAILBOXES; i++) {
+		_inFlight[i].tag = 0;
+	}
+}
+
+bool BufferedCAN::subscribe(const Subscription* subscriptions, int count) {
+	bool fits = true;
+
+	for (int i = 0; i < count; i++) {
+		if (_subscriptionCount >= CAN_DISPATCH_SIZE) {
+			fits = false;
+			break;
+		}
+		_subscriptions[_subscriptionCount++] = subscriptions[i];
+	}
+
+	if (_programFilters() > CAN_FILTER_BANKS) {
+		// accept everything again (bank 0 with an empty mask), dispatch() does the filtering
+		filter(0, 0, CANStandard, 0);
+		fits = false;
+	}
+
+	return fits;
+}
+
+void BufferedCAN::start() {
+	attach(callback(this, &BufferedCAN::_onRx), CAN::RxIrq);
+	attach(callback(this, &BufferedCAN::_onTx), CAN::TxIrq);
+	attach(callback(this, &BufferedCAN::_onOverrun), CAN::DoIrq);
+}
+
+bool BufferedCAN::post(const CANMessage& msg, uint32_t tag, uint32_t stampUs) {
+	bool queued = _txQueue.tryPush(TxFrame{msg, tag, stampUs});
+
+	// the tx interrupt only fires when a mailbox empties, so an idle bus is started from here
+	// the critical section keeps this and the isr from both being the queue's consumer at once
+	core_util_critical_section_enter();
+	_onTx();
+	core_util_critical_section_exit();
+
+	return queued;
+}
+
+int BufferedCAN::dispatch() {
+	CANMessage msg;
+	int count = 0;
+
+	while (_rxQueue.tryPop(msg)) {
+		for (int i = 0; i < _subscriptionCount; i++) {
+			if (_subscriptions[i].id == msg.id)
+				_subscriptions[i].handler(msg);
+		}
+		count++;
+	}
+
+	return count;
+}
+
+int BufferedCAN::_programFilters() {
+	int banks = 0;
+
+	for (int i = 0; i < _subscriptionCount; i++) {
+		unsigned int id = _subscriptions[i].id;
+		bool programmed = false;
+		for (int j = 0; j < i; j++)
+			programmed |= _subscriptions[j].id == id;
+
+		// bank 0 accepts every frame after reset, it's the first one to be overwritten
+		if (!programmed && banks++ < CAN_FILTER_BANKS)
+			filter(id, 0x7FF, CANStandard, banks - 1);
+	}
+
+	return banks;
+}
+
+void BufferedCAN::_onRx() {
+	CANMessage msg;
+
+	// CAN::read takes a mutex, which isn't allowed in an isr: read through the hal instead
+	// the whole fifo is emptied, the interrupt stays pending while a frame is left in it
+	while (can_read(&_can, &msg, 0)) {
+		_rxQueue.tryPush(msg);
+	}
+}
+
+void BufferedCAN::_onTx() {
+	_reapMailboxes();
+
+	// CAN::write takes a mutex too, fill free mailboxes through the hal
+	while (true) {
+		if (!_txHeld) {
+			if (!_txQueue.tryPop(_txFrame))
+				return;
+			_txHeld = true;
+		}
+		int mailbox = _freeMailbox();
+		if (mailbox < 0 || !can_write(&_can, _txFrame.msg, 0))
+			return;		// all mailboxes busy, the next tx interrupt continues
+		_inFlight[mailbox] = _txFrame;
+		_txHeld = false;
+	}
+}
+
+int BufferedCAN::_freeMailbox() {
+	// the same search can_write() does, so this is the mailbox it is about to fill
+	uint32_t status = _can.CanHandle.Instance->TSR;
+
+	for (int i = 0; i < CAN_TX_MAILBOXES; i++) {
+		if (status & s_mailboxEmpty[i])
+			return i;
+	}
+
+	return -1;
+}
+
+void BufferedCAN::_reapMailboxes() {
+	uint32_t status = _can.CanHandle.Instance->TSR;
+
+	// a mailbox which holds a tracked frame and is empty again has sent it (or lost it to an abort)
+	for (int i = 0; i < CAN_TX_MAILBOXES; i++) {
+		if (_inFlight[i].tag == 0 || !(status & s_mailboxEmpty[i]))
+			continue;
+		_txDone.tryPush(TxDone{_inFlight[i].tag, us_ticker_read() - _inFlight[i].stampUs});
+		_inFlight[i].tag = 0;
+	}
+}
+
+void BufferedCAN::_onOverrun() {
+	_overruns.fetch_add(1, std::memory_order_relaxed);
+}
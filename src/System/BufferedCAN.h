@@ -0,0 +1,131 @@
+#ifndef _BUFFERED_CAN_H_
+#define _BUFFERED_CAN_H_
+
+#include <atomic>
+#include <mbed.h>
+
+#include "LockFreeQueue.h"
+
+#define CAN_RX_QUEUE_SIZE 32		// frames buffered between two main loop passes
+#define CAN_TX_QUEUE_SIZE 16		// frames waiting for a free transmit mailbox
+#define CAN_DISPATCH_SIZE 8			// max number of subscriptions
+#define CAN_FILTER_BANKS 14			// bxCAN filter banks of a single CAN instance
+#define CAN_TX_MAILBOXES 3			// bxCAN transmit mailboxes
+#define CAN_TX_DONE_QUEUE_SIZE 8	// tracked frames sent between two main loop passes
+
+/**
+ * @brief CAN bus whose RX interrupt moves every frame out of the three hardware FIFO slots into a lock-free queue
+ *
+ * The main loop drains the queue with dispatch(), which calls the handlers subscribed to each frame's id.
+ * post() queues frames for transmission without blocking, the TX interrupt refills the mailboxes from the queue.
+ * A posted frame can be tracked: once it has left its mailbox nextTxDone() reports how long it took from a
+ * caller supplied timestamp.
+ */
+class BufferedCAN : public CAN {
+	public:
+		typedef void (*Handler)(const CANMessage& msg);
+
+		/**
+		 * @brief one row of a subscription table: frames with this id are decoded by handler,
+		 * several rows may share an id
+		 */
+		struct Subscription {
+			unsigned int id;
+			Handler handler;
+		};
+
+		/**
+		 * @brief a tracked frame which has left its transmit mailbox
+		 */
+		struct TxDone {
+			uint32_t tag;			// as passed to post()
+			uint32_t latencyUs;		// from the stamp passed to post() to the mailbox emptying
+		};
+
+		BufferedCAN(PinName rd, PinName td, int hz);
+		~BufferedCAN() { }
+
+		/**
+		 * @brief registers a subscription table and programs one hardware filter bank per subscribed
+		 * standard id, so frames nobody subscribed to never raise an interrupt; call before start()
+		 *
+		 * If there are more ids than filter banks every frame is accepted and dispatch() discards the rest.
+		 *
+		 * @return false if the table doesn't fit into the dispatch table or the filter banks
+		 */
+		bool subscribe(const Subscription* subscriptions, int count);
+
+		/**
+		 * @brief attaches the RX, TX and data overrun interrupts
+		 */
+		void start();
+
+		/**
+		 * @brief (main loop) queues a frame for transmission, never blocks
+		 *
+		 * @param tag if not 0 the frame is reported by nextTxDone() once it has been sent
+		 * @param stampUs us_ticker time the reported latency is measured from
+		 * @return false if the TX queue was full and the frame was dropped
+		 */
+		bool post(const CANMessage& msg, uint32_t tag = 0, uint32_t stampUs = 0);
+
+		/**
+		 * @brief (main loop) takes the next tracked frame which has been sent
+		 *
+		 * @return false if there is none
+		 */
+		bool nextTxDone(TxDone& done) { return _txDone.tryPop(done); }
+
+		/**
+		 * @brief (main loop) hands every buffered frame to its handler, frames without a handler are discarded
+		 *
+		 * @return number of frames drained
+		 */
+		int dispatch();
+
+		/**
+		 * @brief frames lost because the queue was full
+		 */
+		uint32_t dropped() const { return _rxQueue.dropped(); }
+
+		/**
+		 * @brief frames lost in a hardware FIFO overrun
+		 */
+		uint32_t overruns() const { return _overruns.load(std::memory_order_relaxed); }
+
+		/**
+		 * @brief highest number of frames that waited in the queue
+		 */
+		uint32_t highWaterMark() const { return _rxQueue.highWaterMark(); }
+
+		/**
+		 * @brief frames lost because the TX queue was full
+		 */
+		uint32_t txDropped() const { return _txQueue.dropped(); }
+
+	private:
+		struct TxFrame {
+			CANMessage msg;
+			uint32_t tag;
+			uint32_t stampUs;
+		};
+
+		LockFreeQueue<CANMessage, CAN_RX_QUEUE_SIZE> _rxQueue;	// rx isr adds to this, main loop drains
+		LockFreeQueue<TxFrame, CAN_TX_QUEUE_SIZE> _txQueue;		// main loop adds to this, tx isr drains
+		LockFreeQueue<TxDone, CAN_TX_DONE_QUEUE_SIZE> _txDone;	// tx isr adds to this, main loop drains
+		TxFrame _txFrame;										// popped but not accepted by a full mailbox yet
+		bool _txHeld;
+		TxFrame _inFlight[CAN_TX_MAILBOXES];					// tracked frames per mailbox, tag 0 if untracked
+		Subscription _subscriptions[CAN_DISPATCH_SIZE];
+		int _subscriptionCount;
+		std::atomic<uint32_t> _overruns;
+
+		int _programFilters();
+		void _onRx();
+		void _onTx();
+		int _freeMailbox();
+		void _reapMailboxes();
+		void _onOverrun();
+};
+
+#endif
@@ -0,0 +1,55 @@
+#include "ButtonDebouncer.h"
+
+ButtonDebouncer::ButtonDebouncer(uint32_t samplePeriodMs, uint32_t debounceMs, uint32_t longPressMs, uint32_t doublePressMs, uint8_t activeLow) :
+	_samplePeriodMs(samplePeriodMs), _counterPeriodMs(debounceMs / 4), _longPressMs(longPressMs),
+	_doublePressMs(doublePressMs), _activeLow(activeLow), _nowMs(0), _nextCountMs(0), _count0(0), _count1(0), _longSent(0), _state(0) {
+	for (int i = 0; i < BUTTON_COUNT; i++) {
+		_pressedAt[i] = 0;
+		_lastPressAt[i] = 0 - _doublePressMs - 1;		// no press before: the first one can't be a double press
+	}
+}
+
+void ButtonDebouncer::sample(uint8_t raw) {
+	_nowMs += _samplePeriodMs;
+	if ((int32_t)(_nowMs - _nextCountMs) < 0)
+		return;
+	_nextCountMs = _nowMs + _counterPeriodMs;
+
+	uint8_t state = _state.load(std::memory_order_relaxed);
+
+	// counters of inputs which agree with their state are reset, the others count up and wrap to 0 on the 4th sample
+	uint8_t delta = raw ^ _activeLow ^ state;
+	_count1 = (_count1 ^ _count0) & delta;
+	_count0 = ~_count0 & delta;
+	uint8_t toggled = delta & ~(_count0 | _count1);
+
+	state ^= toggled;
+	_state.store(state, std::memory_order_release);
+
+	for (int i = 0; i < BUTTON_COUNT; i++) {
+		uint8_t bit = 1 << i;
+
+		if (toggled & bit) {
+			if (state & bit) {
+				_emit(i, ButtonEventType::Press);
+				_pressedAt[i] = _nowMs;
+				if (_nowMs - _lastPressAt[i] <= _doublePressMs) {
+					_emit(i, ButtonEventType::DoublePress);
+					_lastPressAt[i] = _nowMs - _doublePressMs - 1;		// a third press starts over
+				} else {
+					_lastPressAt[i] = _nowMs;
+				}
+				_longSent &= ~bit;
+			} else {
+				_emit(i, ButtonEventType::Release);
+			}
+		} else if ((state & bit) && !(_longSent & bit) && _nowMs - _pressedAt[i] >= _longPressMs) {
+			_emit(i, ButtonEventType::LongPress);
+			_longSent |= bit;
+		}
+	}
+}
+
+void ButtonDebouncer::_emit(int button, ButtonEventType type) {
+	_events.tryPush(ButtonEvent{(uint8_t)button, type});
+}
@@ -0,0 +1,75 @@
+#ifndef _BUTTON_DEBOUNCER_H_
+#define _BUTTON_DEBOUNCER_H_
+
+#include <atomic>
+#include <stdint.h>
+
+#include "LockFreeQueue.h"
+
+#define BUTTON_COUNT 8
+#define BUTTON_EVENT_QUEUE_SIZE 16
+
+enum class ButtonEventType : uint8_t { Press, Release, LongPress, DoublePress };
+
+struct ButtonEvent {
+	uint8_t button;
+	ButtonEventType type;
+};
+
+/**
+ * @brief Debounces 8 inputs at once and turns them into press, release, long-press and double-press events
+ *
+ * Each bit has a 2 bit vertical counter (the counter bits of all inputs live in two bytes), an input changes its
+ * debounced state after 4 consecutive samples that differ from it. sample() is fed at a fixed period, typically
+ * from the shift register scanner, and only every debounceMs / 4 a sample goes through the counters.
+ * Events go into a lock-free queue for one consumer.
+ */
+class ButtonDebouncer {
+	public:
+		/**
+		 * @param activeLow inputs which read 0 while pressed
+		 */
+		ButtonDebouncer(uint32_t samplePeriodMs, uint32_t debounceMs, uint32_t longPressMs, uint32_t doublePressMs, uint8_t activeLow = 0);
+		~ButtonDebouncer() { }
+
+		/**
+		 * @brief (producer) raw inputs, bit i = input i
+		 */
+		void sample(uint8_t raw);
+
+		/**
+		 * @brief debounced inputs, bit i = input i, 1 = pressed / on regardless of polarity
+		 */
+		uint8_t state() const { return _state.load(std::memory_order_acquire); }
+
+		/**
+		 * @brief (consumer) takes the oldest event
+		 *
+		 * @return false if there is none
+		 */
+		bool nextEvent(ButtonEvent& event) { return _events.tryPop(event); }
+
+		uint32_t droppedEvents() const { return _events.dropped(); }
+
+	private:
+		uint32_t _samplePeriodMs;
+		uint32_t _counterPeriodMs;
+		uint32_t _longPressMs;
+		uint32_t _doublePressMs;
+		uint8_t _activeLow;
+		uint32_t _nowMs;
+		uint32_t _nextCountMs;
+
+		// vertical counter: bit i of _count0 / _count1 form the counter of input i
+		uint8_t _count0;
+		uint8_t _count1;
+		uint8_t _longSent;			// inputs whose current press already produced a long press
+		uint32_t _pressedAt[BUTTON_COUNT];
+		uint32_t _lastPressAt[BUTTON_COUNT];
+		std::atomic<uint8_t> _state;
+		LockFreeQueue<ButtonEvent, BUTTON_EVENT_QUEUE_SIZE> _events;
+
+		void _emit(int button, ButtonEventType type);
+};
+
+#endif
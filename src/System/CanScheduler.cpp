@@ -0,0 +1,123 @@
+#include "CanScheduler.h"
+
+using namespace std::chrono;
+
+CanScheduler::CanScheduler(BufferedCAN* can, const Channel* channels, int count) :
+	_can(can), _channels(channels), _count(count < CAN_SCHEDULER_SIZE ? count : CAN_SCHEDULER_SIZE) {
+	for (int i = 0; i < _count; i++) {
+		_state[i] = ChannelState{0, -1, 0, false, Statistics{0, 0, 0, 0, 0, 0}};
+	}
+}
+
+void CanScheduler::start() {
+	_clock.start();
+}
+
+void CanScheduler::trigger(int channel) {
+	trigger(channel, us_ticker_read());
+}
+
+void CanScheduler::trigger(int channel, uint32_t stampUs) {
+	ChannelState& state = _state[channel];
+
+	if (!state.triggered) {
+		state.triggeredUs = stampUs;
+		state.triggered = true;
+	}
+}
+
+void CanScheduler::run() {
+	_collectLatencies();
+
+	int64_t now = _now();
+
+	for (int i = 0; i < _count; i++) {
+		const Channel& channel = _channels[i];
+		ChannelState& state = _state[i];
+		bool periodic = channel.periodMs > 0;
+
+		if (!state.triggered && !(periodic && now >= state.deadlineUs))
+			continue;
+		if (!_gapElapsed(i, now))
+			continue;
+
+		_send(i, now, state.triggered);
+		if (state.triggered) {
+			state.triggered = false;
+			// heartbeat: the next periodic frame is one period after this one
+			state.deadlineUs = now + channel.periodMs * 1000;
+		} else if (periodic) {
+			state.deadlineUs += channel.periodMs * 1000;
+			// more than a whole period late: skip the missed deadlines instead of sending a burst
+			if (state.deadlineUs <= now)
+				state.deadlineUs = now + channel.periodMs * 1000;
+		}
+	}
+}
+
+int64_t CanScheduler::jitterUs(int channel) const {
+	const Statistics& stats = _state[channel].stats;
+	int64_t period = _channels[channel].periodMs * 1000;
+
+	if (stats.intervals == 0 || period == 0)
+		return 0;
+
+	int64_t late = stats.maxIntervalUs - period;
+	int64_t early = period - stats.minIntervalUs;
+	return late > early ? late : early;
+}
+
+int64_t CanScheduler::_now() {
+	return duration_cast<microseconds>(_clock.elapsed_time()).count();
+}
+
+bool CanScheduler::_gapElapsed(int channel, int64_t now) {
+	const Channel& self = _channels[channel];
+
+	for (int i = 0; i < _count; i++) {
+		if (_channels[i].id != self.id || _state[i].lastSentUs < 0)
+			continue;
+		if (now - _state[i].lastSentUs < (int64_t)self.minGapMs * 1000)
+			return false;
+	}
+
+	return true;
+}
+
+void CanScheduler::_send(int channel, int64_t now, bool triggered) {
+	ChannelState& state = _state[channel];
+	CANMessage msg;
+
+	msg.id = _channels[channel].id;
+	msg.format = CANStandard;
+	msg.type = CANData;
+	msg.len = 0;
+	_channels[channel].encode(msg);
+	// triggered frames are tagged with channel + 1, their latency comes back through _collectLatencies()
+	_can->post(msg, triggered ? channel + 1 : 0, state.triggeredUs);
+
+	// a heartbeat restarts with every triggered frame, so only the deadline driven intervals say anything about jitter
+	if (!triggered && state.lastSentUs >= 0) {
+		int64_t interval = now - state.lastSentUs;
+		if (state.stats.intervals == 0 || interval < state.stats.minIntervalUs)
+			state.stats.minIntervalUs = interval;
+		if (state.stats.intervals == 0 || interval > state.stats.maxIntervalUs)
+			state.stats.maxIntervalUs = interval;
+		state.stats.intervals++;
+	}
+	state.stats.sent++;
+	state.lastSentUs = now;
+}
+
+void CanScheduler::_collectLatencies() {
+	BufferedCAN::TxDone done;
+
+	while (_can->nextTxDone(done)) {
+		if (done.tag == 0 || done.tag > (uint32_t)_count)
+			continue;
+		Statistics& stats = _state[done.tag - 1].stats;
+		stats.lastLatencyUs = done.latencyUs;
+		if (stats.lastLatencyUs > stats.maxLatencyUs)
+			stats.maxLatencyUs = stats.lastLatencyUs;
+	}
+}
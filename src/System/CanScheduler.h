@@ -0,0 +1,102 @@
+#ifndef _CAN_SCHEDULER_H_
+#define _CAN_SCHEDULER_H_
+
+#include <mbed.h>
+
+#include "BufferedCAN.h"
+
+#define CAN_SCHEDULER_SIZE 8		// max number of channels
+
+/**
+ * @brief Deadline-based transmit scheduler for a table of periodic and event-triggered CAN messages
+ *
+ * Periodic channels are due on fixed deadlines (last deadline + period), so loop time shifts single
+ * frames but never accumulates into drift. Event channels are sent once per trigger(). A periodic
+ * channel can be triggered too, its period then works as a heartbeat which restarts with every frame.
+ * No channel is sent sooner than its minimum gap after the previous frame with the same id. Due frames
+ * are posted to the non-blocking TX queue of a BufferedCAN.
+ *
+ * Triggered frames are tracked through the BufferedCAN: their latency runs from the timestamp given to
+ * trigger() until the frame has left its transmit mailbox, so TX queue, mailbox and bus time are included.
+ */
+class CanScheduler {
+	public:
+		/**
+		 * @brief fills data and len of a frame right before it is posted
+		 */
+		typedef void (*Encoder)(CANMessage& msg);
+
+		struct Channel {
+			unsigned int id;
+			Encoder encode;
+			uint32_t periodMs;		// 0: only sent when triggered, else period / heartbeat
+			uint32_t minGapMs;		// min time since the last frame with the same id
+		};
+
+		/**
+		 * @brief measured send intervals and latencies of one channel
+		 */
+		struct Statistics {
+			uint32_t sent;
+			uint32_t intervals;			// number of deadline driven frames the interval range covers
+			int64_t minIntervalUs;
+			int64_t maxIntervalUs;
+			int64_t lastLatencyUs;		// trigger stamp to sent, latest triggered frame
+			int64_t maxLatencyUs;
+		};
+
+		CanScheduler(BufferedCAN* can, const Channel* channels, int count);
+		~CanScheduler() { }
+
+		/**
+		 * @brief starts the clock, the first deadline of every periodic channel is now
+		 */
+		void start();
+
+		/**
+		 * @brief requests one transmission of a channel, latency is measured from the first unserved trigger
+		 */
+		void trigger(int channel);
+
+		/**
+		 * @brief requests one transmission of a channel on behalf of an earlier event
+		 *
+		 * @param stampUs us_ticker time of the event, e.g. when the ADC published the sample that caused it
+		 */
+		void trigger(int channel, uint32_t stampUs);
+
+		/**
+		 * @brief (main loop) posts every frame which is due
+		 */
+		void run();
+
+		const Statistics& statistics(int channel) const { return _state[channel].stats; }
+
+		/**
+		 * @brief largest deviation of a periodic channel's measured interval from its period, only frames sent
+		 * on their deadline count, triggered frames are sent whenever the event happens
+		 */
+		int64_t jitterUs(int channel) const;
+
+	private:
+		struct ChannelState {
+			int64_t deadlineUs;
+			int64_t lastSentUs;
+			uint32_t triggeredUs;		// us_ticker time
+			bool triggered;
+			Statistics stats;
+		};
+
+		BufferedCAN* _can;
+		const Channel* _channels;
+		int _count;
+		ChannelState _state[CAN_SCHEDULER_SIZE];
+		Timer _clock;
+
+		int64_t _now();
+		bool _gapElapsed(int channel, int64_t now);
+		void _send(int channel, int64_t now, bool triggered);
+		void _collectLatencies();
+};
+
+#endif
@@ -0,0 +1,39 @@
+#include "ChangeDispatcher.h"
+
+ChangeDispatcher::ChangeDispatcher(EventFlags* wakeFlags, uint32_t wakeFlag) :
+	_count(0), _changed(0), _held(0), _nextDeadline(INT64_MAX), _wakeFlags(wakeFlags), _wakeFlag(wakeFlag) { }
+
+int ChangeDispatcher::attach(DeferredChange* source) {
+	if (_count == CHANGE_DISPATCHER_MAX)
+		return -1;
+
+	_sources[_count] = source;
+	return _count++;
+}
+
+void ChangeDispatcher::markChanged(int slot) {
+	// the value is already stored, the bit only says it needs to go to the listeners
+	_changed.fetch_or(1u << slot, std::memory_order_release);
+	if (_wakeFlags != nullptr)
+		_wakeFlags->set(_wakeFlag);
+}
+
+void ChangeDispatcher::dispatch(int64_t millis) {
+	if (_held != 0 && millis < _nextDeadline && !pending())
+		return;
+
+	uint32_t changed = _changed.exchange(0, std::memory_order_acquire) | _held;
+	_held = 0;
+	_nextDeadline = INT64_MAX;
+	for (int slot = 0; changed != 0; slot++, changed >>= 1) {
+		if (!(changed & 1))
+			continue;
+
+		int64_t retryAt = _sources[slot]->dispatchChange(millis);
+		if (retryAt != INT64_MAX) {
+			_held |= 1u << slot;
+			if (retryAt < _nextDeadline)
+				_nextDeadline = retryAt;
+		}
+	}
+}
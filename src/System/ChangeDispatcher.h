@@ -0,0 +1,75 @@
+#ifndef _CHANGE_DISPATCHER_H_
+#define _CHANGE_DISPATCHER_H_
+
+#include <atomic>
+#include <stdint.h>
+#include <mbed.h>
+
+#define CHANGE_DISPATCHER_MAX 32
+
+/**
+ * @brief A source of changes whose listeners run on the thread calling ChangeDispatcher::dispatch()
+ */
+class DeferredChange {
+	public:
+		virtual ~DeferredChange() { }
+
+		/**
+		 * @brief runs the listeners with the latest value, unless its change policy holds it back
+		 *
+		 * @return when to try again if the value was held back, INT64_MAX otherwise
+		 */
+		virtual int64_t dispatchChange(int64_t millis) = 0;
+};
+
+/**
+ * @brief Moves change notifications from the threads which set values to one subscriber thread
+ *
+ * Each attached source owns a bit of a lock-free changed-set. markChanged() only sets the bit and wakes the
+ * subscriber, dispatch() takes the whole set at once and notifies every marked source a single time, however
+ * often it changed in between, so listeners always see the latest value. Sources which hold a change back stay
+ * marked until the time they asked for.
+ */
+class ChangeDispatcher {
+	public:
+		/**
+		 * @param wakeFlags flags of the subscriber thread, wakeFlag is set in them on every change (may be null)
+		 */
+		ChangeDispatcher(EventFlags* wakeFlags = nullptr, uint32_t wakeFlag = 0);
+		~ChangeDispatcher() { }
+
+		/**
+		 * @brief registers a source, call before any thread sets it
+		 *
+		 * @return the slot to pass to markChanged(), -1 if all slots are taken
+		 */
+		int attach(DeferredChange* source);
+
+		/**
+		 * @brief (any thread or isr) marks the source in slot as changed
+		 */
+		void markChanged(int slot);
+
+		/**
+		 * @brief (subscriber thread) notifies every source changed since the last call or held back until millis
+		 */
+		void dispatch(int64_t millis);
+
+		/**
+		 * @brief earliest time a held back change should be dispatched again, INT64_MAX if there is none
+		 */
+		int64_t nextDeadline() const { return _nextDeadline; }
+
+		bool pending() const { return _changed.load(std::memory_order_relaxed) != 0; }
+
+	private:
+		DeferredChange* _sources[CHANGE_DISPATCHER_MAX];
+		int _count;
+		std::atomic<uint32_t> _changed;
+		uint32_t _held;					// subscriber thread only
+		int64_t _nextDeadline;
+		EventFlags* _wakeFlags;
+		uint32_t _wakeFlag;
+};
+
+#endif
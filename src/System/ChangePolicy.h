@@ -0,0 +1,92 @@
+#ifndef _CHANGE_POLICY_H_
+#define _CHANGE_POLICY_H_
+
+#include <math.h>
+#include <stdint.h>
+#include <type_traits>
+
+/**
+ * @brief When a new value of a property is worth telling its listeners about; all zero notifies every change
+ */
+struct ChangePolicy {
+	float resolution;			// step the value is displayed in, values and bands are compared in whole steps, 0: exact
+	float deadband;				// absolute change from the last notified value needed to notify again
+	float relativeDeadband;		// same as a fraction of the last notified value, the larger band applies
+	float hysteresis;			// extra change needed when the value turns around, stops flicker between two steps
+	uint32_t minIntervalMs;		// minimum time between two notifications, later changes are held until then
+};
+
+/**
+ * @brief Applies a ChangePolicy to the values of one property
+ *
+ * Bands only apply to arithmetic types, any other type is significant whenever it differs from the last notified
+ * value. With a resolution, values are rounded to it first and the bands are rounded to whole steps, so a change of
+ * one displayed step is exactly one step even if the floats it comes from differ by a little less. An insignificant
+ * value is dropped (the next change is compared against the last notified value again), a significant one which
+ * comes too soon is held until the interval has passed and then rechecked.
+ */
+template <class T>
+class ChangeFilter {
+	public:
+		ChangeFilter() : _policy(), _notified(false), _direction(0), _lastMillis(0) { }
+
+		void setPolicy(const ChangePolicy& policy) { _policy = policy; }
+
+		/**
+		 * @param retryAt set to when value should be checked again if it is held, INT64_MAX if it is dropped
+		 *
+		 * @return true if value should be notified now, it becomes the last notified value
+		 */
+		bool accept(const T& value, int64_t millis, int64_t& retryAt) {
+			retryAt = INT64_MAX;
+			int8_t direction = 0;
+			if (_notified && !_isSignificant(value, direction, std::is_arithmetic<T>()))
+				return false;
+
+			if (_notified && millis < _lastMillis + _policy.minIntervalMs) {
+				retryAt = _lastMillis + _policy.minIntervalMs;
+				return false;
+			}
+
+			_last = value;
+			_direction = direction;
+			_lastMillis = millis;
+			_notified = true;
+			return true;
+		}
+
+	private:
+		ChangePolicy _policy;
+		T _last;
+		bool _notified;
+		int8_t _direction;			// sign of the last notified change
+		int64_t _lastMillis;
+
+		bool _isSignificant(const T& value, int8_t& direction, std::true_type) {
+			double delta = _quantise((double)value) - _quantise((double)_last);
+			if (delta == 0)
+				return false;
+
+			direction = delta > 0 ? 1 : -1;
+			double band = fmax(_quantise(_policy.deadband), _quantise(_policy.relativeDeadband * fabs((double)_last)));
+			if (_direction != 0 && direction != _direction)
+				band += _quantise(_policy.hysteresis);
+
+			return fabs(delta) >= band;
+		}
+
+		/**
+		 * @brief value in whole resolution steps, unchanged without a resolution
+		 */
+		double _quantise(double value) const {
+			return _policy.resolution > 0 ? round(value / _policy.resolution) : value;
+		}
+
+		bool _isSignificant(const T& value, int8_t& direction, std::false_type) {
+			T last = _last;
+			T current = value;
+			return current != last;
+		}
+};
+
+#endif
@@ -0,0 +1,214 @@
+#ifndef _FIXED_MAP_H_
+#define _FIXED_MAP_H_
+
+#include <stdint.h>
+#include <type_traits>
+
+/**
+ * @brief Fixed-capacity hash map with open addressing and no heap allocation
+ *
+ * Entries live in an inline table probed linearly from the key's hash; erase shifts the following entries of the
+ * probe run back, so there are no tombstones and lookups stay short. Keys are integral. Not thread safe, see
+ * ThreadedMap for sharing a map between threads.
+ *
+ * @tparam K integral key type
+ * @tparam V value type, default constructible
+ * @tparam N capacity, power of two
+ */
+template <class K, class V, uint32_t N, class Enable = void>
+class FixedMap {
+	static_assert(N > 0 && (N & (N - 1)) == 0, "FixedMap capacity must be a power of two");
+	static_assert(std::is_integral<K>::value, "FixedMap keys must be integral or an enum");
+
+	public:
+		FixedMap() : _size(0) {
+			for (uint32_t i = 0; i < N; i++) {
+				_used[i] = false;
+			}
+		}
+		~FixedMap() { }
+
+		/**
+		 * @return the value of key, nullptr if it isn't in the map
+		 */
+		V* find(K key) {
+			int index = _indexOf(key);
+			return index < 0 ? nullptr : &_values[index];
+		}
+
+		const V* find(K key) const {
+			return const_cast<FixedMap*>(this)->find(key);
+		}
+
+		bool containsKey(K key) const { return find(key) != nullptr; }
+
+		/**
+		 * @brief adds key or replaces its value
+		 *
+		 * @return false if key is new and the map is full
+		 */
+		bool set(K key, const V& value) {
+			V* slot = _insert(key);
+			if (slot == nullptr)
+				return false;
+
+			*slot = value;
+			return true;
+		}
+
+		/**
+		 * @return false if key wasn't in the map
+		 */
+		bool erase(K key) {
+			int index = _indexOf(key);
+			if (index < 0)
+				return false;
+
+			// move back every entry of the run which probed past the hole
+			uint32_t hole = index;
+			uint32_t next = (hole + 1) & (N - 1);
+			_used[hole] = false;
+			while (_used[next]) {
+				uint32_t home = _hash(_keys[next]);
+				if (((next - home) & (N - 1)) >= ((next - hole) & (N - 1))) {
+					_keys[hole] = _keys[next];
+					_values[hole] = _values[next];
+					_used[hole] = true;
+					_used[next] = false;
+					hole = next;
+				}
+				next = (next + 1) & (N - 1);
+			}
+			_values[hole] = V();
+			_size--;
+			return true;
+		}
+
+		/**
+		 * @brief calls f(key, value) for every entry, in no particular order; f must not add or erase entries
+		 */
+		template <class F>
+		void forEach(F f) {
+			for (uint32_t i = 0; i < N; i++) {
+				if (_used[i])
+					f(_keys[i], _values[i]);
+			}
+		}
+
+		uint32_t size() const { return _size; }
+		uint32_t capacity() const { return N; }
+
+	private:
+		K _keys[N];
+		V _values[N];
+		bool _used[N];
+		uint32_t _size;
+
+		static uint32_t _hash(K key) {
+			// Fibonacci hashing: the top bits of the product spread consecutive keys over the table
+			uint32_t bits = 0;
+			for (uint32_t n = N; n > 1; n >>= 1) {
+				bits++;
+			}
+			return bits == 0 ? 0 : ((uint32_t)key * 2654435769u) >> (32 - bits);
+		}
+
+		int _indexOf(K key) const {
+			uint32_t index = _hash(key);
+			for (uint32_t probes = 0; probes < N && _used[index]; probes++) {
+				if (_keys[index] == key)
+					return index;
+				index = (index + 1) & (N - 1);
+			}
+			return -1;
+		}
+
+		V* _insert(K key) {
+			uint32_t index = _hash(key);
+			for (uint32_t probes = 0; probes < N; probes++) {
+				if (!_used[index]) {
+					_used[index] = true;
+					_keys[index] = key;
+					_size++;
+					return &_values[index];
+				}
+				if (_keys[index] == key)
+					return &_values[index];
+				index = (index + 1) & (N - 1);
+			}
+			return nullptr;
+		}
+};
+
+/**
+ * @brief FixedMap for enum keys: a dense array indexed by the key, N is the number of enumerators
+ *
+ * Lookups are a bounds check and an index, keys outside 0..N-1 are never in the map.
+ */
+template <class K, class V, uint32_t N>
+class FixedMap<K, V, N, typename std::enable_if<std::is_enum<K>::value>::type> {
+	public:
+		FixedMap() : _size(0) {
+			for (uint32_t i = 0; i < N; i++) {
+				_used[i] = false;
+				_values[i] = V();
+			}
+		}
+		~FixedMap() { }
+
+		V* find(K key) {
+			uint32_t index = (uint32_t)key;
+			return index < N && _used[index] ? &_values[index] : nullptr;
+		}
+
+		const V* find(K key) const {
+			return const_cast<FixedMap*>(this)->find(key);
+		}
+
+		bool containsKey(K key) const { return find(key) != nullptr; }
+
+		bool set(K key, const V& value) {
+			uint32_t index = (uint32_t)key;
+			if (index >= N)
+				return false;
+
+			if (!_used[index]) {
+				_used[index] = true;
+				_size++;
+			}
+			_values[index] = value;
+			return true;
+		}
+
+		bool erase(K key) {
+			uint32_t index = (uint32_t)key;
+			if (index >= N || !_used[index])
+				return false;
+
+			_used[index] = false;
+			_values[index] = V();
+			_size--;
+			return true;
+		}
+
+		/**
+		 * @brief calls f(key, value) for every entry in key order; f must not add or erase entries
+		 */
+		template <class F>
+		void forEach(F f) {
+			for (uint32_t i = 0; i < N; i++) {
+				if (_used[i])
+					f((K)i, _values[i]);
+			}
+		}
+
+		uint32_t size() const { return _size; }
+		uint32_t capacity() const { return N; }
+
+	private:
+		V _values[N];
+		bool _used[N];
+		uint32_t _size;
+};
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef _LOCK_FREE_QUEUE_H_
+#define _LOCK_FREE_QUEUE_H_
+
+#include <atomic>
+#include <stdint.h>
+#include <type_traits>
+
+/**
+ * @brief What a full queue does with a new element
+ */
+enum class QueueOverflow {
+	DropNewest,		// tryPush fails, the new element is dropped
+	DropOldest		// the oldest element is overwritten, tryPush always succeeds
+};
+
+/**
+ * @brief Fixed-capacity single-producer / single-consumer queue without locks or heap allocation
+ *
+ * Exactly one thread (or ISR) may push and exactly one thread may pop. Head and tail
+ * are free-running indices, only the producer moves head and only the consumer moves
+ * tail, except that DropOldest lets the producer push tail forward on overflow.
+ * T has to be trivially copyable: a pop that races an overwrite is discarded and retried.
+ *
+ * @tparam T element type
+ * @tparam N capacity, power of two
+ * @tparam Policy overflow policy
+ */
+template <class T, uint32_t N, QueueOverflow Policy = QueueOverflow::DropNewest>
+class LockFreeQueue {
+	static_assert(N > 0 && (N & (N - 1)) == 0, "LockFreeQueue capacity must be a power of two");
+	static_assert(std::is_trivially_copyable<T>::value, "LockFreeQueue elements must be trivially copyable");
+
+	public:
+		LockFreeQueue() : _head(0), _tail(0), _highWaterMark(0), _dropped(0) { }
+		~LockFreeQueue() { }
+
+		/**
+		 * @brief (producer) adds an element
+		 *
+		 * @return false if the queue was full and the element was dropped
+		 */
+		bool tryPush(const T& elem) {
+			uint32_t head = _head.load(std::memory_order_relaxed);
+			uint32_t tail = _tail.load(std::memory_order_acquire);
+
+			if (head - tail >= N) {
+				if (Policy == QueueOverflow::DropNewest) {
+					_dropped.fetch_add(1, std::memory_order_relaxed);
+					return false;
+				}
+				// the consumer may have popped meanwhile, then there's room after all
+				if (_tail.compare_exchange_strong(tail, tail + 1, std::memory_order_acq_rel))
+					_dropped.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			_buffer[head & (N - 1)] = elem;
+			_head.store(head + 1, std::memory_order_release);
+
+			uint32_t used = head + 1 - _tail.load(std::memory_order_relaxed);
+			if (used > _highWaterMark.load(std::memory_order_relaxed))
+				_highWaterMark.store(used, std::memory_order_relaxed);
+
+			return true;
+		}
+
+		/**
+		 * @brief (consumer) removes the oldest element
+		 *
+		 * @return false if the queue was empty
+		 */
+		bool tryPop(T& elem) {
+			uint32_t tail = _tail.load(std::memory_order_relaxed);
+
+			while (true) {
+				if (tail == _head.load(std::memory_order_acquire))
+					return false;
+
+				elem = _buffer[tail & (N - 1)];
+				if (Policy == QueueOverflow::DropNewest) {
+					_tail.store(tail + 1, std::memory_order_release);
+					return true;
+				}
+				// fails if the producer overwrote this slot while it was copied, tail is reloaded
+				if (_tail.compare_exchange_strong(tail, tail + 1, std::memory_order_acq_rel))
+					return true;
+			}
+		}
+
+		bool empty() const {
+			return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+		}
+
+		uint32_t size() const {
+			return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+		}
+
+		uint32_t capacity() const {
+			return N;
+		}
+
+		/**
+		 * @brief highest number of queued elements seen so far
+		 */
+		uint32_t highWaterMark() const {
+			return _highWaterMark.load(std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief number of elements lost to overflow so far
+		 */
+		uint32_t dropped() const {
+			return _dropped.load(std::memory_order_relaxed);
+		}
+
+	private:
+		T _buffer[N];
+		std::atomic<uint32_t> _head;			// next slot to write, producer owned
+		std::atomic<uint32_t> _tail;			// next slot to read, consumer owned
+		std::atomic<uint32_t> _highWaterMark;
+		std::atomic<uint32_t> _dropped;
+};
+
+#endif
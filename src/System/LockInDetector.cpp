@@ -0,0 +1,49 @@
+#include "LockInDetector.h"
+
+LockInDetector::LockInDetector(AdcScanner* adc, int channel, DigitalOut* led, int carrierHz, int window, int32_t threshold) :
+	_adc(adc), _channel(channel), _led(led), _carrierHz(carrierHz), _window(window), _threshold(threshold),
+	_ledOn(false), _offSample(0), _sum(0), _periods(0), _votes(0), _detected(false), _confidence(0), _amplitude(0) { }
+
+void LockInDetector::start() {
+	_ledOn = false;
+	_led->write(0);
+	_sum = 0;
+	_periods = 0;
+	_votes = 0;
+	_ticker.attach(callback(this, &LockInDetector::_onTick), std::chrono::microseconds(500000 / _carrierHz));
+}
+
+void LockInDetector::stop() {
+	_ticker.detach();
+	_led->write(0);
+}
+
+void LockInDetector::_onTick() {
+	// the sample belongs to the LED state of the half period which ends now
+	int32_t sample = _adc->sample(_channel);
+
+	if (!_ledOn) {
+		_offSample = sample;
+	} else {
+		int32_t share = sample - _offSample;
+		_sum += share;
+		_votes += share > _threshold;
+
+		if (++_periods == _window) {
+			int32_t amplitude = _sum / _window;
+			bool detected = amplitude > _threshold;
+			int agreeing = detected ? _votes : _window - _votes;
+
+			_amplitude.store(amplitude, std::memory_order_relaxed);
+			_confidence.store((uint8_t)(agreeing * 100 / _window), std::memory_order_relaxed);
+			_detected.store(detected, std::memory_order_relaxed);
+
+			_sum = 0;
+			_periods = 0;
+			_votes = 0;
+		}
+	}
+
+	_ledOn = !_ledOn;
+	_led->write(_ledOn);
+}
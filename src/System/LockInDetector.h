@@ -0,0 +1,73 @@
+#ifndef _LOCK_IN_DETECTOR_H_
+#define _LOCK_IN_DETECTOR_H_
+
+#include <atomic>
+#include <mbed.h>
+
+#include "AdcScanner.h"
+
+/**
+ * @brief Synchronous (lock-in) detector for a reflective sensor: an LED is switched at a fixed carrier, the sensor
+ * is sampled once per LED half period and the samples are demodulated with the LED state (+ while on, - while off)
+ *
+ * Light at even multiples of the carrier and steady light cancel in every period, other frequencies average out over
+ * the window, the demodulated mean is the LED's share of the signal. Light at an odd multiple of the carrier doesn't
+ * cancel, it turns into an offset: pick a carrier none of whose odd multiples is a multiple of the lamp flicker
+ * frequency (100 Hz and 120 Hz), e.g. 250 Hz, and a window which spans whole flicker periods. Runs from a Ticker,
+ * results are read without blocking.
+ */
+class LockInDetector {
+	public:
+		/**
+		 * @param adc scanner which samples the sensor
+		 * @param channel sensor channel of the scanner
+		 * @param led LED which lights the sensor
+		 * @param carrierHz LED frequency, a half period has to be at least two scan times of the scanner
+		 * @param window carrier periods per decision
+		 * @param threshold minimum LED share of the signal (0 .. 0xFFFF) for detected()
+		 */
+		LockInDetector(AdcScanner* adc, int channel, DigitalOut* led, int carrierHz, int window, int32_t threshold);
+		~LockInDetector() { }
+
+		void start();
+		void stop();
+
+		/**
+		 * @brief result of the last window: LED share above the threshold
+		 */
+		bool detected() const { return _detected.load(std::memory_order_relaxed); }
+
+		/**
+		 * @brief share of the carrier periods in the last window which agree with detected() (0 .. 100 %)
+		 */
+		uint8_t confidence() const { return _confidence.load(std::memory_order_relaxed); }
+
+		/**
+		 * @brief demodulated LED share of the signal, averaged over the last window (0 .. 0xFFFF)
+		 */
+		int32_t amplitude() const { return _amplitude.load(std::memory_order_relaxed); }
+
+	private:
+		AdcScanner* _adc;
+		int _channel;
+		DigitalOut* _led;
+		int _carrierHz;
+		int _window;
+		int32_t _threshold;
+		Ticker _ticker;
+
+		// isr state
+		bool _ledOn;
+		int32_t _offSample;		// first half of the current carrier period
+		int32_t _sum;			// demodulated samples of the current window
+		int _periods;
+		int _votes;				// periods of the current window with an LED share above the threshold
+
+		std::atomic<bool> _detected;
+		std::atomic<uint8_t> _confidence;
+		std::atomic<int32_t> _amplitude;
+
+		void _onTick();
+};
+
+#endif
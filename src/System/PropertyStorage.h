@@ -0,0 +1,136 @@
+#ifndef _PROPERTY_STORAGE_H_
+#define _PROPERTY_STORAGE_H_
+
+#include <atomic>
+#include <stdint.h>
+#include <type_traits>
+#include <Mutex.h>
+#include <mbed_critical.h>
+
+#define SEQLOCK_MAX_SIZE 16
+
+namespace util {
+
+	/**
+	 * @brief value of a word-sized type in a std::atomic, neither load nor store ever blocks
+	 */
+	template <class T>
+	class AtomicStorage {
+		public:
+			AtomicStorage(T value) : _value(value) { }
+
+			T load() const {
+				return _value.load(std::memory_order_acquire);
+			}
+
+			/**
+			 * @return true if value differs from the one it replaced
+			 */
+			bool store(T value) {
+				T old = _value.exchange(value, std::memory_order_acq_rel);
+				return old != value;
+			}
+
+		private:
+			std::atomic<T> _value;
+	};
+
+	/**
+	 * @brief value of a small trivially copyable type behind a sequence lock
+	 *
+	 * The sequence is odd while a store is under way; a load retries until it copied the value without a store
+	 * overlapping it. Stores are serialized by a (short) critical section, so a load never waits on a preempted
+	 * thread and a store never waits at all.
+	 */
+	template <class T>
+	class SeqLockStorage {
+		public:
+			SeqLockStorage(T value) : _sequence(0), _value(value) { }
+
+			T load() const {
+				T ret;
+				uint32_t before;
+				uint32_t after;
+				do {
+					before = _sequence.load(std::memory_order_acquire);
+					ret = _value;
+					std::atomic_thread_fence(std::memory_order_acquire);
+					after = _sequence.load(std::memory_order_relaxed);
+				} while ((before & 1) || before != after);
+
+				return ret;
+			}
+
+			/**
+			 * @return true if value differs from the one it replaced
+			 */
+			bool store(T value) {
+				core_util_critical_section_enter();
+				T old = _value;
+				bool changed = old != value;
+				if (changed) {
+					uint32_t sequence = _sequence.load(std::memory_order_relaxed);
+					_sequence.store(sequence + 1, std::memory_order_relaxed);
+					std::atomic_thread_fence(std::memory_order_release);
+					_value = value;
+					_sequence.store(sequence + 2, std::memory_order_release);
+				}
+				core_util_critical_section_exit();
+
+				return changed;
+			}
+
+		private:
+			std::atomic<uint32_t> _sequence;
+			T _value;
+	};
+
+	/**
+	 * @brief value of any other type behind a mutex
+	 */
+	template <class T>
+	class MutexStorage {
+		public:
+			MutexStorage(T value) : _value(value) { }
+
+			T load() const {
+				_mutex.lock();
+				T ret = _value;
+				_mutex.unlock();
+
+				return ret;
+			}
+
+			/**
+			 * @return true if value differs from the one it replaced
+			 */
+			bool store(T value) {
+				_mutex.lock();
+				bool changed = value != _value;
+				if (changed)
+					_value = value;
+				_mutex.unlock();
+
+				return changed;
+			}
+
+		private:
+			mutable Mutex _mutex;
+			T _value;
+	};
+
+	/**
+	 * @brief picks the cheapest storage for T at compile time: atomic for word-sized values, a sequence lock for
+	 * small structs, a mutex for everything else
+	 */
+	template <class T>
+	struct PropertyStorage {
+		typedef typename std::conditional<std::is_trivially_copyable<T>::value && sizeof(T) <= sizeof(uint32_t),
+			AtomicStorage<T>,
+			typename std::conditional<std::is_trivially_copyable<T>::value && sizeof(T) <= SEQLOCK_MAX_SIZE,
+				SeqLockStorage<T>,
+				MutexStorage<T>>::type>::type type;
+	};
+}
+
+#endif
@@ -0,0 +1,59 @@
+#include "RateGroupScheduler.h"
+
+using namespace std::chrono;
+
+void RateGroupScheduler::_init(const RateGroup* groups, int count) {
+	_groups = groups;
+	_count = count;
+	for (int i = 0; i < _count; i++) {
+		_stats[i] = Statistics{0, 0, 0, 0, 0, 0};
+	}
+}
+
+void RateGroupScheduler::run() {
+	_clock.start();
+	for (int i = 0; i < _count; i++) {
+		_releaseUs[i] = 0;
+	}
+
+	while (true) {
+		for (int i = 0; i < _count; i++) {
+			int64_t start = _now();
+			if (start < _releaseUs[i])
+				continue;
+
+			Statistics& stats = _stats[i];
+			int64_t period = (int64_t)_groups[i].periodMs * 1000;
+			int64_t late = start - _releaseUs[i];
+			stats.lastLateUs = late;
+			if (stats.lastLateUs > stats.maxLateUs)
+				stats.maxLateUs = stats.lastLateUs;
+
+			_groups[i].task();
+			stats.lastExecUs = _now() - start;
+			if (stats.lastExecUs > stats.maxExecUs)
+				stats.maxExecUs = stats.lastExecUs;
+			stats.runs++;
+
+			// a start a whole period late means releases went by (this group or faster ones ran too long),
+			// skip them but stay on the period grid
+			int64_t skipped = late / period;
+			stats.overruns += skipped;
+			_releaseUs[i] += (skipped + 1) * period;
+		}
+
+		int64_t next = _releaseUs[0];
+		for (int i = 1; i < _count; i++) {
+			if (_releaseUs[i] < next)
+				next = _releaseUs[i];
+		}
+		// the kernel sleeps in whole ticks, round up so the thread doesn't wake before the release
+		int64_t wait = next - _now();
+		if (wait > 0)
+			ThisThread::sleep_for(milliseconds((wait + 999) / 1000));
+	}
+}
+
+int64_t RateGroupScheduler::_now() {
+	return duration_cast<microseconds>(_clock.elapsed_time()).count();
+}
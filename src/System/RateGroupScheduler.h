@@ -0,0 +1,63 @@
+#ifndef _RATE_GROUP_SCHEDULER_H_
+#define _RATE_GROUP_SCHEDULER_H_
+
+#include <mbed.h>
+#include <rtos.h>
+
+#define RATE_GROUP_MAX 8
+
+/**
+ * @brief Runs a table of rate groups (functions with a fixed period) from one thread and sleeps in between
+ *
+ * Every group is released on fixed deadlines (last release + period). When several groups are due, they run in
+ * table order, so the table is sorted from the highest rate down. How late a group starts is measured against its
+ * release with a microsecond clock. A group which starts a whole period or more late has overrun: the releases it
+ * missed are skipped and counted instead of being run back to back, the next one stays on the period grid.
+ */
+class RateGroupScheduler {
+	public:
+		typedef void (*Task)(void);
+
+		struct RateGroup {
+			const char* name;
+			Task task;
+			uint32_t periodMs;
+		};
+
+		struct Statistics {
+			uint32_t runs;
+			uint32_t overruns;			// releases skipped
+			uint32_t lastLateUs;		// start after the release
+			uint32_t maxLateUs;
+			uint32_t lastExecUs;
+			uint32_t maxExecUs;
+		};
+
+		template <int N>
+		RateGroupScheduler(const RateGroup (&groups)[N]) {
+			static_assert(N <= RATE_GROUP_MAX, "more rate groups than RATE_GROUP_MAX");
+			_init(groups, N);
+		}
+		~RateGroupScheduler() { }
+
+		/**
+		 * @brief releases the groups forever, call from the thread they should run in
+		 */
+		void run();
+
+		int count() const { return _count; }
+		const RateGroup& group(int index) const { return _groups[index]; }
+		const Statistics& statistics(int index) const { return _stats[index]; }
+
+	private:
+		const RateGroup* _groups;
+		int _count;
+		int64_t _releaseUs[RATE_GROUP_MAX];
+		Statistics _stats[RATE_GROUP_MAX];
+		Timer _clock;
+
+		void _init(const RateGroup* groups, int count);
+		int64_t _now();
+};
+
+#endif
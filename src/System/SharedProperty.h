@@ -2,71 +2,89 @@
 #define _SHARED_PROPERTY_H_
 
 #include <string>
-#include <vector>
-#include <Mutex.h>
 
+#include "ChangeDispatcher.h"
+#include "ChangePolicy.h"
+#include "PropertyStorage.h"
 #include "util.h"
 
 using namespace util;
 
+#define PROPERTY_MAX_LISTENERS 4
+
 /**
  * @brief Defines a property whose value is shared between arbitrary objects / threads
  * 
+ * The value is kept in the cheapest storage that is safe for T (see PropertyStorage), so reading a char, float or
+ * small struct never blocks on an RTOS mutex. Listeners run synchronously in set() unless the property was handed to
+ * a ChangeDispatcher, then they run on the dispatcher's thread with the latest value, filtered by a ChangePolicy.
+ * 
  * @tparam T
  */
 template <class T>
-class SharedProperty {
+class SharedProperty : public DeferredChange {
 	public:
-		SharedProperty(T value) : _value(value) { }
+		SharedProperty(T value) : _value(value), _dispatcher(nullptr), _slot(-1) { }
 
-		~SharedProperty() {
-			for (Command* command : _valueChangedDelegates) {
-				delete command;
-			}
-		}
+		~SharedProperty() { }
 
 		void set(T value) {
-			_stateMutex.lock();
-			if (value != _value) {
-				_value = value;
-				_stateMutex.unlock();
-				
-				_onValueChanged();
-			} else {
-				_stateMutex.unlock();
-			}
+			if (!_value.store(value))
+				return;
+
+			if (_dispatcher != nullptr)
+				_dispatcher->markChanged(_slot);
+			else
+				_onValueChanged(value);
 		}
 
 		T value() {
-			_stateMutex.lock();
-			T ret = _value;
-			_stateMutex.unlock();
+			return _value.load();
+		}
 
-			return ret;
+		/**
+		 * @return false if the property has no room for another listener
+		 */
+		bool addValueChangedListener(const Listener<T>& listener) {
+			return _valueChangedListeners.add(listener);
 		}
 
-		void addValueChangedListener(Command* command) {
-			_valueChangedDelegates.push_back(command);
+		/**
+		 * @brief from now on set() only stores the value and marks the property changed, the listeners run in
+		 * dispatcher.dispatch() for the changes policy lets through; call before the property is set from other threads
+		 */
+		void dispatchOn(ChangeDispatcher& dispatcher, const ChangePolicy& policy = ChangePolicy()) {
+			if (_dispatcher != nullptr)
+				return;
+
+			_filter.setPolicy(policy);
+			_slot = dispatcher.attach(this);
+			if (_slot >= 0)
+				_dispatcher = &dispatcher;
 		}
 
-		void removeValueChangedListener(Command* command) {
-			std::vector<Command*>::iterator it = std::find(_valueChangedDelegates.begin(), _valueChangedDelegates.end(), command);
+		int64_t dispatchChange(int64_t millis) override {
+			T current = value();
+			int64_t retryAt;
+			if (_filter.accept(current, millis, retryAt))
+				_onValueChanged(current);
+
+			return retryAt;
+		}
 
-			if (it != _valueChangedDelegates.end()) {
-				_valueChangedDelegates.erase(std::remove(_valueChangedDelegates.begin(), _valueChangedDelegates.end(), command),
-					_valueChangedDelegates.end());
-			}
+		void removeValueChangedListener(const Listener<T>& listener) {
+			_valueChangedListeners.remove(listener);
 		}
 
 	private:
-		T _value;
-		Mutex _stateMutex;
-		std::vector<Command*> _valueChangedDelegates;
-
-		void _onValueChanged() {
-			for (Command* command : _valueChangedDelegates) {
-				command->execute((CommandArgs)&_value);
-			}
+		typename PropertyStorage<T>::type _value;
+		ChangeDispatcher* _dispatcher;
+		int _slot;
+		ChangeFilter<T> _filter;			// dispatcher thread only
+		ListenerList<T, PROPERTY_MAX_LISTENERS> _valueChangedListeners;
+
+		void _onValueChanged(T value) {
+			_valueChangedListeners.notify(value);
 		}
 };
 
@@ -0,0 +1,39 @@
+#include "ShiftRegisterScanner.h"
+
+ShiftRegisterScanner::ShiftRegisterScanner(PinName clk, PinName ledOut, PinName latch, PinName buttonIn) :
+	_clk(clk, 0), _ledOut(ledOut, 0), _latch(latch, 0), _buttonIn(buttonIn), _buttons(0), _leds(0), _scans(0) { }
+
+void ShiftRegisterScanner::start(std::chrono::microseconds period) {
+	_ticker.attach(callback(this, &ShiftRegisterScanner::_scan), period);
+}
+
+void ShiftRegisterScanner::stop() {
+	_ticker.detach();
+}
+
+void ShiftRegisterScanner::_scan() {
+	uint8_t buttons = 0;
+	uint8_t leds = _leds.load(std::memory_order_acquire);
+
+	// input 7 comes out first
+	_latch.write(1);
+	for (int i = 7; i >= 0; i--) {
+		buttons |= _buttonIn.read() << i;
+		_clk.write(1);
+		_clk.write(0);
+	}
+	_latch.write(0);
+
+	// output 7 goes in first, the LEDs are active low
+	for (int i = 7; i >= 0; i--) {
+		_ledOut.write(!((leds >> i) & 1));
+		_clk.write(1);
+		_clk.write(0);
+	}
+
+	_buttons.store(buttons, std::memory_order_release);
+	_scans.fetch_add(1, std::memory_order_relaxed);
+
+	if (_onScan)
+		_onScan(buttons);
+}
@@ -0,0 +1,57 @@
+#ifndef _SHIFT_REGISTER_SCANNER_H_
+#define _SHIFT_REGISTER_SCANNER_H_
+
+#include <atomic>
+#include <chrono>
+#include <mbed.h>
+
+/**
+ * @brief Scans the 8 bit button input and LED output shift registers from a Ticker at a fixed rate
+ *
+ * Both registers share clock and latch. Every scan loads and shifts in the buttons, then shifts out the LEDs,
+ * which the next scan's latch pulse applies. The main loop only exchanges whole bytes with the isr: buttons()
+ * is the snapshot of the last complete scan, setLeds() the pattern for the next one.
+ */
+class ShiftRegisterScanner {
+	public:
+		ShiftRegisterScanner(PinName clk, PinName ledOut, PinName latch, PinName buttonIn);
+		~ShiftRegisterScanner() { }
+
+		void start(std::chrono::microseconds period);
+		void stop();
+
+		/**
+		 * @brief called from the isr with the buttons of every scan, e.g. to debounce them at the scan rate
+		 */
+		void attach(Callback<void(uint8_t)> onScan) { _onScan = onScan; }
+
+		/**
+		 * @brief button inputs of the last complete scan, bit i = input i of the register
+		 */
+		uint8_t buttons() const { return _buttons.load(std::memory_order_acquire); }
+
+		/**
+		 * @brief LED outputs for the next scan, bit i = output i of the register (1 = on)
+		 */
+		void setLeds(uint8_t leds) { _leds.store(leds, std::memory_order_release); }
+
+		/**
+		 * @brief number of completed scans
+		 */
+		uint32_t scans() const { return _scans.load(std::memory_order_relaxed); }
+
+	private:
+		DigitalOut _clk;
+		DigitalOut _ledOut;
+		DigitalOut _latch;
+		DigitalIn _buttonIn;
+		Ticker _ticker;
+		Callback<void(uint8_t)> _onScan;
+		std::atomic<uint8_t> _buttons;
+		std::atomic<uint8_t> _leds;
+		std::atomic<uint32_t> _scans;
+
+		void _scan();
+};
+
+#endif
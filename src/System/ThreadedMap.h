@@ -1,63 +1,70 @@
 #ifndef _THREADED_MAP_H_
 #define _THREADED_MAP_H_
 
-#include <unordered_map>
+#include <stdint.h>
 #include <Mutex.h>
 
-template <class K, class V>
+#include "FixedMap.h"
+
+/**
+ * @brief FixedMap shared between threads
+ *
+ * Single lookups copy the value out under the lock, so nothing handed out refers into the map once the lock is
+ * released. To look at or change several entries consistently (eg. iterate), hold a Guard for as long as the
+ * map is used through it.
+ */
+template <class K, class V, uint32_t N>
 class ThreadedMap {
 	public:
-		~ThreadedMap() { }
+		/**
+		 * @brief locks the map for its lifetime and gives access to it
+		 */
+		class Guard {
+			public:
+				Guard(ThreadedMap& map) : _map(map) { _map._stateMutex.lock(); }
+				~Guard() { _map._stateMutex.unlock(); }
 
-		V& operator[](const K& k) {
-			_stateMutex.lock();
-			V& ret = _map[k];
-			_stateMutex.unlock();
+				FixedMap<K, V, N>& map() { return _map._map; }
+				FixedMap<K, V, N>* operator->() { return &_map._map; }
 
-			return ret;
-		}
+			private:
+				ThreadedMap& _map;
+		};
 
-		typename std::unordered_map<K, V>::iterator find(K key) {
-			_stateMutex.lock();
-			auto ret = _map.find(key);
-			_stateMutex.unlock();
+		~ThreadedMap() { }
 
-			return ret;
-		}
+		/**
+		 * @brief copies the value of key to value
+		 *
+		 * @return false if key isn't in the map, value is left alone
+		 */
+		bool get(K key, V& value) {
+			Guard guard(*this);
+			const V* found = guard->find(key);
+			if (found != nullptr)
+				value = *found;
 
-		void erase(K key) {
-			_stateMutex.lock();
-			_map.erase(key);
-			_stateMutex.unlock();
+			return found != nullptr;
 		}
 
-		typename std::unordered_map<K, V>::iterator begin() {
-			_stateMutex.lock();
-			auto ret = _map.begin();
-			_stateMutex.unlock();
-			
-			return ret;
+		bool set(K key, const V& value) {
+			Guard guard(*this);
+			return guard->set(key, value);
 		}
 
-		typename std::unordered_map<K, V>::iterator end() {
-			_stateMutex.lock();
-			auto ret = _map.end();
-			_stateMutex.unlock();
-			
-			return ret;
+		bool erase(K key) {
+			Guard guard(*this);
+			return guard->erase(key);
 		}
 
 		bool containsKey(K key) {
-			_stateMutex.lock();
-			bool ret = _map.find(key) != _map.end();
-			_stateMutex.unlock();
-
-			return ret;
+			Guard guard(*this);
+			return guard->containsKey(key);
 		}
 
 	private:
-		std::unordered_map<K, V> _map;
+		FixedMap<K, V, N> _map;
 		Mutex _stateMutex;
 };
 
-#endif
\ No newline at end of file
+#endif
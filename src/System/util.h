@@ -14,40 +14,99 @@ namespace util {
 	};
 
 	/**
-	 * @brief encapsulates a callback function with possible args T
-	 * 
+	 * @brief a callback taking a T, bound at compile time and stored inline
+	 *
+	 * bind() generates one thunk per callback which calls it with its real owner type, so invoking a listener costs
+	 * one indirect call and nothing is allocated. A callback whose parameter is not a T doesn't match bind() and
+	 * fails to compile.
+	 *
 	 * @tparam T type of param for callback function
 	 */
 	template <class T>
-	class FunctionalCallback : public Command {
+	class Listener {
 		public:
-			FunctionalCallback(void (*callback)(const T)) : _callback(callback) { }
-			~FunctionalCallback() { }
-			virtual void execute(CommandArgs args) {
-				_callback(*((T*)args));
+			Listener() : _owner(nullptr), _thunk(nullptr) { }
+
+			/**
+			 * @brief listener calling owner->*Method
+			 */
+			template <class C, void (C::*Method)(const T)>
+			static Listener bind(C* owner) {
+				return Listener(owner, &_methodThunk<C, Method>);
+			}
+
+			/**
+			 * @brief listener calling a free function
+			 */
+			template <void (*Function)(const T)>
+			static Listener bind() {
+				return Listener(nullptr, &_functionThunk<Function>);
 			}
 
+			void operator()(const T& value) const { _thunk(_owner, value); }
+
+			bool isBound() const { return _thunk != nullptr; }
+
+			bool operator==(const Listener& rhs) const { return _owner == rhs._owner && _thunk == rhs._thunk; }
+
 		private:
-			void (*_callback)(const T);
+			typedef void (*Thunk)(void* owner, const T& value);
+
+			void* _owner;
+			Thunk _thunk;
+
+			Listener(void* owner, Thunk thunk) : _owner(owner), _thunk(thunk) { }
+
+			template <class C, void (C::*Method)(const T)>
+			static void _methodThunk(void* owner, const T& value) {
+				(static_cast<C*>(owner)->*Method)(value);
+			}
+
+			template <void (*Function)(const T)>
+			static void _functionThunk(void* owner, const T& value) {
+				Function(value);
+			}
 	};
 
 	/**
-	 * @brief encapsulates a callback method for type T
-	 * 
-	 * @tparam T class which implements method
-	 * @tparam R param for T::method
+	 * @brief up to N listeners for T in inline storage
 	 */
-	template <class T, class R>
-	class Delegate : public Command {
+	template <class T, int N>
+	class ListenerList {
 		public:
-			Delegate(T* owner, void (T::*callback)(const R)) : _owner(owner), _callback(callback) { }
-			~Delegate() { }
-			void execute(CommandArgs args) override {
-				(_owner->*_callback)(*((R*)args));
+			ListenerList() : _count(0) { }
+
+			/**
+			 * @return false if the list is full
+			 */
+			bool add(const Listener<T>& listener) {
+				if (_count == N || !listener.isBound())
+					return false;
+
+				_listeners[_count++] = listener;
+				return true;
+			}
+
+			void remove(const Listener<T>& listener) {
+				int kept = 0;
+				for (int i = 0; i < _count; i++) {
+					if (!(_listeners[i] == listener))
+						_listeners[kept++] = _listeners[i];
+				}
+				_count = kept;
+			}
+
+			void notify(const T& value) const {
+				for (int i = 0; i < _count; i++) {
+					_listeners[i](value);
+				}
 			}
+
+			int count() const { return _count; }
+
 		private:
-			T* _owner;
-			void (T::*_callback)(const R);
+			Listener<T> _listeners[N];
+			int _count;
 	};
 }
 
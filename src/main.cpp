@@ -7,35 +7,68 @@
 #include <cmath>
 #include <string>
 
+#include "AdcScanner.h"
+#include "BufferedCAN.h"
+#include "ButtonDebouncer.h"
+#include "CanScheduler.h"
+#include "LockInDetector.h"
+#include "RateGroupScheduler.h"
 #include "SPI_TFT_ILI9341.h"
+#include "ShiftRegisterScanner.h"
 #include "SharedProperty.h"
 #include "SteeringDisplay.h"
 #include "can_common.h"
 #include "rtos.h"
 
+// build with -D BENCHMARK_GLYPHS to time the big font encodings at boot
+#ifdef BENCHMARK_GLYPHS
+#include "GlyphBenchmark.h"
+#endif
+
 using namespace std;
 using namespace std::chrono;
 
 // #define DEBUG_MODE
-#define DMS_DELTA_THRESHOLD 500
+#define DMS_DELTA_THRESHOLD 500         // of 10000
+// no odd multiple of the carrier is a harmonic of 100 / 120 Hz lamp flicker, which would demodulate to an offset
+#define DMS_CARRIER_FREQUENCY 250       // Hz, a half period spans two adc scans
+#define DMS_WINDOW 25                   // carrier periods per decision: one every 100 ms
 #define MIN_THROTTLE_INPUT 3000
 #define MAX_THROTTLE_INPUT 7000
 
+#define INPUT_INTERVAL 1
+#define CONTROL_INTERVAL 10
 #define ACCESSORIES_TRANSMIT_INTERVAL 50
+#define ACCESSORIES_FRAME_GAP 1
+#define CAN_REPORT_INTERVAL 1000
 #define MOTOR_CONTROLLER_TRANSMIT_INTERVAL 100
+#define THROTTLE_HEARTBEAT_INTERVAL 100
+#define THROTTLE_MIN_SPACING 10
+#define THROTTLE_DEADBAND 2
+#define SHIFT_REGISTER_SCAN_INTERVAL 1
 #define DEBOUNCE_TIME 50
-#define GESTURE_MARGIN 500
+#define GESTURE_MARGIN 500      // long press
+#define DOUBLE_PRESS_TIME 300
+#define ACTIVE_LOW_BUTTONS (1 << JOYSTICK_BUTTON)
 
 #define MIN_THROTTLE_OUTPUT 0
 #define MAX_THROTTLE_OUTPUT 255
 #define THROTTLE_RANGE (MAX_THROTTLE_INPUT - MIN_THROTTLE_INPUT)
 
+#define ADC_OVERSAMPLING 4      // 16x in hardware
+#define ADC_DECIMATION 4        // scans averaged per value, a new value every ~3.3 ms
+#define ADC_FILTER_SHIFT 1
+
 #define CAN_BATT_SOC_SCALING_FACTOR 2.0
 #define CAN_BATT_VOLTAGE_SCALING_FACTOR 10.0
+#define BATTERY_DISPLAY_RESOLUTION 0.1f // one displayed decimal
+#define BATTERY_DISPLAY_DEADBAND 0.1f   // every displayed step
+#define BATTERY_DISPLAY_HYSTERESIS 0.1f // turning around takes two steps
+#define BATTERY_DISPLAY_INTERVAL 500
 
 SPI_TFT_ILI9341 TFT(D11, D12, D13, D9, D0, A4);
 DigitalOut sdCs(A0);
-CAN can(D10, D2, 500000);
+BufferedCAN can(D10, D2, 500000);
 SteeringDisplay display(&TFT);
 
 #ifdef DEBUG_MODE
@@ -47,27 +80,22 @@ DigitalIn brake(D1, PullUp);
 
 
 // Ready
-AnalogIn dms(A1);
-AnalogIn throttle(A6);
 DigitalOut dmsLed(A5);
 
-// shift registers
-DigitalOut shiftClk(D3);
-DigitalOut ledOut(D4);
-DigitalOut shiftLatch(D5);
-DigitalIn buttonIn(D6);
+// Throttle, dms and joystick are scanned in the background, in the order of AdcChannel
+const PinName analogPins[] = {A6, A1, A3, A2};
+AdcScanner analogIn(analogPins, sizeof(analogPins) / sizeof(analogPins[0]), ADC_OVERSAMPLING, ADC_DECIMATION, ADC_FILTER_SHIFT);
+LockInDetector dmsDetector(&analogIn, AdcDms, &dmsLed, DMS_CARRIER_FREQUENCY, DMS_WINDOW, DMS_DELTA_THRESHOLD * 0xFFFF / 10000);
+
+// shift registers (clock, led data, latch, button data), scanned in the background
+ShiftRegisterScanner shiftRegs(D3, D4, D5, D6);
+ButtonDebouncer buttons(SHIFT_REGISTER_SCAN_INTERVAL, DEBOUNCE_TIME, GESTURE_MARGIN, DOUBLE_PRESS_TIME, ACTIVE_LOW_BUTTONS);
 
 // shift reg
 bool buttonState[8] = {}; 
 bool ledState[8] = {};
 
-// Joystick
-AnalogIn joyX(A3);
-AnalogIn joyY(A2);
-
-Timer timerMotor;
 Timer clockResetTimer;
-Timer timerAccessories;
 
 bool lastHazards = false;
 Ticker timerFlash;
@@ -90,80 +118,132 @@ SharedProperty<data_t> lastGesture(0);
 SharedProperty<data_t> blink(0);
 SharedProperty<steering_time_t> timeVal(steering_time_t{0, 0});
 
+// CAN messages to receive: only these ids pass the hardware filters
+const BufferedCAN::Subscription canSubscriptions[] = {
+    {CAN_URBAN_MC_RPM, onMotorRpm},
+    {CAN_TELEMETRY_GPS_DATA, onGpsSpeed},
+    {CAN_ORIONBMS_PACK, onBmsSoc},
+    {CAN_ORIONBMS_PACK, onBmsVoltage},
+};
+
+// CAN messages to transmit, indexed by CanTxChannel
+const CanScheduler::Channel canTxChannels[] = {
+    {CAN_ACC_OPERATION, encodeHazardsOff, 0, 0},
+    {CAN_ACC_OPERATION, encodeAccessories, 0, ACCESSORIES_FRAME_GAP},     // follows a hazards off frame after the gap
+    {CAN_STEERING_THROTTLE, encodeThrottle, THROTTLE_HEARTBEAT_INTERVAL, THROTTLE_MIN_SPACING},
+    {CAN_STEERING_READY, encodeReady, MOTOR_CONTROLLER_TRANSMIT_INTERVAL, 0},
+};
+CanScheduler canScheduler(&can, canTxChannels, sizeof(canTxChannels) / sizeof(canTxChannels[0]));
+
+// main thread work, highest rate first
+const RateGroupScheduler::RateGroup rateGroupTable[] = {
+    {"input", runInputGroup, INPUT_INTERVAL},
+    {"control", runControlGroup, CONTROL_INTERVAL},
+    {"accessories", handle_accessories, ACCESSORIES_TRANSMIT_INTERVAL},
+    {"motor", runMotorGroup, MOTOR_CONTROLLER_TRANSMIT_INTERVAL},
+#ifdef DEBUG_MODE
+    {"report", printStatistics, CAN_REPORT_INTERVAL},
+#endif
+};
+RateGroupScheduler rateGroups(rateGroupTable);
+
 // global variables shared between main and display threads
 int64_t g_lastTime = 0;
 int counter = 0;
 int eshift = 1;
 int prev_state = 0; // 0 neutral, 1 up, -1 down
+throttle_t sentThrottle = 0;
 
 void initializeDisplay() {
     // initialize
     display.init();
 
     // add data display bindings
-    display.addDynamicGraphicBinding(dmsVal, SteeringDisplay::Dms);
-    display.addDynamicGraphicBinding(ignitionVal, SteeringDisplay::Ignition);
-    display.addDynamicGraphicBinding(brakeVal, SteeringDisplay::Brake);
-    display.addDynamicGraphicBinding(batterySocVal, SteeringDisplay::Soc);
-    display.addDynamicGraphicBinding(batteryVoltageVal, SteeringDisplay::Voltage);
-    display.addDynamicGraphicBinding(currentSpeedVal, SteeringDisplay::Speed);
-    display.addDynamicGraphicBinding(throttleVal, SteeringDisplay::Power);
-    display.addDynamicGraphicBinding(rpmVal, SteeringDisplay::Rpm);
-    display.addDynamicGraphicBinding(eShiftVal, SteeringDisplay::eShift);
-    display.addDynamicGraphicBinding(lightsVal, SteeringDisplay::Lights);
-    display.addDynamicGraphicBinding(turnLeftVal, SteeringDisplay::LeftSignal);
-    display.addDynamicGraphicBinding(turnRightVal, SteeringDisplay::RightSignal);
-    display.addDynamicGraphicBinding(timeVal, SteeringDisplay::Minutes);
-    display.addDynamicGraphicBinding(blink, SteeringDisplay::Hazards);
+    display.addDynamicGraphicBinding<SteeringDisplay::Dms>(dmsVal);
+    display.addDynamicGraphicBinding<SteeringDisplay::Ignition>(ignitionVal);
+    display.addDynamicGraphicBinding<SteeringDisplay::Brake>(brakeVal);
+    // battery readings are noisy, only redraw for changes the display can show
+    const ChangePolicy batteryPolicy = {BATTERY_DISPLAY_RESOLUTION, BATTERY_DISPLAY_DEADBAND, 0,
+                                         BATTERY_DISPLAY_HYSTERESIS, BATTERY_DISPLAY_INTERVAL};
+    display.addDynamicGraphicBinding<SteeringDisplay::Soc>(batterySocVal, batteryPolicy);
+    display.addDynamicGraphicBinding<SteeringDisplay::Voltage>(batteryVoltageVal, batteryPolicy);
+    display.addDynamicGraphicBinding<SteeringDisplay::Speed>(currentSpeedVal);
+    display.addDynamicGraphicBinding<SteeringDisplay::Power>(throttleVal);
+    display.addDynamicGraphicBinding<SteeringDisplay::Rpm>(rpmVal);
+    display.addDynamicGraphicBinding<SteeringDisplay::eShift>(eShiftVal);
+    display.addDynamicGraphicBinding<SteeringDisplay::Lights>(lightsVal);
+    display.addDynamicGraphicBinding<SteeringDisplay::LeftSignal>(turnLeftVal);
+    display.addDynamicGraphicBinding<SteeringDisplay::RightSignal>(turnRightVal);
+    display.addDynamicGraphicBinding<SteeringDisplay::Minutes>(timeVal);
+    display.addDynamicGraphicBinding<SteeringDisplay::Hazards>(blink);
 }
 
 int main() {
-    timerMotor.start();
     clockResetTimer.start();
-    timerAccessories.start();
+    analogIn.start();
+    dmsDetector.start();
 
-    shiftClk.write(0);
-    ledOut.write(0);
-    shiftLatch.write(0);
+    shiftRegs.attach(callback(&buttons, &ButtonDebouncer::sample));
+    shiftRegs.start(milliseconds(SHIFT_REGISTER_SCAN_INTERVAL));
     sdCs.write(1);
 
+#ifdef BENCHMARK_GLYPHS
+    benchmarkGlyphs(&TFT);
+#endif
+
     // Initalize Accessories--it's impossible for left and right blinker to be on simultaneously so this will cause can update to be sent on boot
     prevAccVal.set(0xFF);
 
     initializeDisplay();
+    initializeCan();
 
-    Thread display_thread;
+    // the display only gets the time the rate groups leave
+    Thread display_thread(osPriorityBelowNormal);
     display_thread.start(runSteeringDisplay);
 
-    dmsLed.write(0);
+    rateGroups.run();
+}
 
-    while (1) {
-        handleTime();
-        handle_accessories();
-        handle_motor_inputs(eshift, prev_state);
-        receive_can();
-        updateShiftRegs();
-        setLedState();
-        blink.set(ledState[HAZARDS_LED]);
+void runInputGroup() {
+    receive_can();
+    handle_throttle(eshift);
+    canScheduler.run();
+}
+
+void runControlGroup() {
+    updateShiftRegs();
+    handleTime();
+    setLedState();
+    blink.set(ledState[HAZARDS_LED]);
+}
+
+void runMotorGroup() {
+    handle_motor_inputs(eshift, prev_state);
+}
+
+#ifdef DEBUG_MODE
+void printStatistics() {
+    for (int i = 0; i < rateGroups.count(); i++) {
+        const RateGroupScheduler::Statistics& stats = rateGroups.statistics(i);
+        printf("%s: %u runs, %u overruns, late %u us (max %u us), exec %u us (max %u us)\n", rateGroups.group(i).name,
+               (unsigned)stats.runs, (unsigned)stats.overruns, (unsigned)stats.lastLateUs, (unsigned)stats.maxLateUs,
+               (unsigned)stats.lastExecUs, (unsigned)stats.maxExecUs);
     }
+    // the throttle is sampled at 1 kHz, printing every sample would choke the console
+    printf("Throttle Input: %04d - Output: %d\n", (int)(analogIn.read(AdcThrottle) * 10000), throttleVal.value());
+    printCanStatistics();
 }
+#endif
 
 void handle_accessories() {
-    if (duration_cast<milliseconds>(timerAccessories.elapsed_time()).count() > ACCESSORIES_TRANSMIT_INTERVAL) {
-        char hazardsOn;
-        char currentAcc = read_accessory_inputs(hazardsOn);
-        if ((prevAccVal.value() != currentAcc)) {
-            // turn hazards off
-            if (hazardsOn) {
-                const unsigned char data[] = {0x2, 0x4 << 1, 0x5 << 1};
-                can.write(CANMessage(CAN_ACC_OPERATION, data, 3));
-                wait_us(1000);
-            }
-            const char data[] = {0, currentAcc};
-            can.write(CANMessage(CAN_ACC_OPERATION, data, 2));
-            prevAccVal.set(currentAcc);
-        }
-        timerAccessories.reset();
+    char hazardsOn;
+    char currentAcc = read_accessory_inputs(hazardsOn);
+    if ((prevAccVal.value() != currentAcc)) {
+        // turn hazards off
+        if (hazardsOn)
+            canScheduler.trigger(TxHazardsOff);
+        prevAccVal.set(currentAcc);
+        canScheduler.trigger(TxAccessories);
     }
 }
 
@@ -196,88 +276,83 @@ char read_accessory_inputs(char &hazards) {
 }
 
 void handle_motor_inputs(int &eshift, int &prev_state) {
-    if (duration_cast<milliseconds>(timerMotor.elapsed_time()).count() > MOTOR_CONTROLLER_TRANSMIT_INTERVAL) {
-        dmsVal.set(getDmsVal());
-        ignitionVal.set(buttonState[IGNITION_BUTTON]);
-        brakeVal.set((char)!brake.read());
-
-        throttle_t currentThrottle = get_throttle_val();
-
-        if (!dmsVal.value() || !ignitionVal.value() || brakeVal.value()) {
-            currentThrottle = 0;
-        }
+    dmsVal.set(getDmsVal());
+    ignitionVal.set(buttonState[IGNITION_BUTTON]);
+
+    int curr_state;
+    int Joystick_x = (int)(analogIn.read(AdcJoystickX)*10000);
+    // printf("voltage= %04d\n",Joystick_x);
+
+    if (Joystick_x > 9000){
+        curr_state = -1;
+    } else if( Joystick_x < 1000){
+        curr_state = 1;
+    } else{
+        curr_state = 0;
+    }
 
-        int curr_state;
-        int Joystick_x = (int)(joyX.read()*10000);
-        // printf("voltage= %04d\n",Joystick_x);
+    if (prev_state == 0){
+        eshift += curr_state;
+    }
+    
+    prev_state = curr_state;
+    
+    // Limit eshift range
+    if(eshift < 1){
+        eshift = 1;
+    } else if(eshift > 5){
+        eshift = 5;
+    } 
+
+    // eShift value is displayed
+    eShiftVal.set(eshift);
+}
 
-        if (Joystick_x > 9000){
-            curr_state = -1;
-        } else if( Joystick_x < 1000){
-            curr_state = 1;
-        } else{
-            curr_state = 0;
-        }
+void handle_throttle(int eshift) {
+    // sampled by the 1 kHz input group, brake is checked here too so it cuts the throttle without waiting for handle_motor_inputs
+    brakeVal.set((char)!brake.read());
 
-        if (prev_state == 0){
-            eshift += curr_state;
-        }
-        
-        prev_state = curr_state;
-        
-        // Limit eshift range
-        if(eshift < 1){
-            eshift = 1;
-        } else if(eshift > 5){
-            eshift = 5;
-        } 
-
-        // eShift value is displayed
-        eShiftVal.set(eshift);
-
-        // eShift modulates the range of throttle provided to the motor controller
-        switch(eshift){
-            case 1:
-                currentThrottle = currentThrottle/5;
-                break;
-            case 2:
-                currentThrottle = currentThrottle/2.5;
-                break;
-            case 3:
-                currentThrottle = currentThrottle/1.66;
-                break;
-            case 4:
-                currentThrottle = currentThrottle/1.25;
-                break;
-            case 5:
-                currentThrottle = currentThrottle;
-                break;
-            default:
-                currentThrottle = 0;
-                break;
-        }
+    throttle_t currentThrottle = get_throttle_val();
 
-        throttleVal.set(currentThrottle);
+    if (!dmsVal.value() || !ignitionVal.value() || brakeVal.value()) {
+        currentThrottle = 0;
+    }
 
-        // Throttle Data
-        const throttle_t throttleData[] = {throttleVal.value()}; 
-        can.write(CANMessage(CAN_STEERING_THROTTLE, throttleData, 1));
+    // eShift modulates the range of throttle provided to the motor controller
+    switch(eshift){
+        case 1:
+            currentThrottle = currentThrottle/5;
+            break;
+        case 2:
+            currentThrottle = currentThrottle/2.5;
+            break;
+        case 3:
+            currentThrottle = currentThrottle/1.66;
+            break;
+        case 4:
+            currentThrottle = currentThrottle/1.25;
+            break;
+        case 5:
+            currentThrottle = currentThrottle;
+            break;
+        default:
+            currentThrottle = 0;
+            break;
+    }
 
-        // Ready Data
-        char ready = (brakeVal.value() << 2) | (dmsVal.value() << 1) | ignitionVal.value();
-        const char readyData[] = {ready};
-        can.write(CANMessage(CAN_STEERING_READY, readyData, 1));
+    throttleVal.set(currentThrottle);
 
-        timerMotor.reset();
+    // send right away on a change beyond the deadband and always when the pedal is released,
+    // the scheduler keeps THROTTLE_MIN_SPACING between frames and repeats the value as heartbeat
+    int delta = (int)currentThrottle - (int)sentThrottle;
+    if (delta > THROTTLE_DEADBAND || delta < -THROTTLE_DEADBAND || (currentThrottle == 0 && sentThrottle != 0)) {
+        // latency is measured from the ADC values the throttle was computed from
+        canScheduler.trigger(TxThrottle, analogIn.publishedUs());
     }
 }
 
 throttle_t get_throttle_val() {
-    int throttleVal = (int)(throttle.read() * 10000);
-
-#ifdef DEBUG_MODE
-    printf("Throttle Input: %04d - ", throttleVal);
-#endif
+    int throttleVal = (int)(analogIn.read(AdcThrottle) * 10000);
 
     // Keep values within min/max
     if (throttleVal <= MIN_THROTTLE_INPUT) {
@@ -296,47 +371,97 @@ throttle_t get_throttle_val() {
 }
 
 data_t getDmsVal() {
-    int dmsCtrl = (int)(dms.read() * 10000);
-    dmsLed.write(1);
-    wait_us(40);
-    int dmsVal = (int)(dms.read() * 10000);
-    dmsLed.write(0);
-    int dmsDelta = dmsVal - dmsCtrl;
 #ifdef DEBUG_MODE
-    printf("DMS Delta: %04d\n", dmsDelta >= 0 ? dmsDelta : 0);
+    printf("DMS Delta: %04d, confidence %d %%\n", (int)(dmsDetector.amplitude() * 10000 / 0xFFFF), dmsDetector.confidence());
 #endif
 
-    return (data_t)(dmsDelta > DMS_DELTA_THRESHOLD);
+    return (data_t)dmsDetector.detected();
 }
 
-// Checks for CAN updates
+void initializeCan() {
+    can.subscribe(canSubscriptions, sizeof(canSubscriptions) / sizeof(canSubscriptions[0]));
+    can.start();
+    canScheduler.start();
+}
+
+// Handles every CAN frame received since the last pass
 void receive_can() {
-    CANMessage msg;
-
-    if (can.read(msg)) {
-        if(msg.id == CAN_URBAN_MC_RPM) {   
-            // Reconstruct the integer value from the byte array
-            int rpm =(msg.data[0] << 8) | msg.data[1];
-            rpmVal.set(rpm);
-        } 
-        else if (msg.id == CAN_TELEMETRY_GPS_DATA) {
-            int speed_kmh =(msg.data[0]);
-            currentSpeedVal.set(speed_kmh); 
-        }
-        else if (msg.id == CAN_ORIONBMS_PACK) {
-            uint8_t socData = msg.data[4];
-            batt_t soc = socData / CAN_BATT_SOC_SCALING_FACTOR;
-            batterySocVal.set(soc);
-            uint16_t voltageData = msg.data[1] | msg.data[0] << 8;
-            batt_t voltage = voltageData / CAN_BATT_VOLTAGE_SCALING_FACTOR;
-            batteryVoltageVal.set(voltage);
-        } 
+    can.dispatch();
+
+#ifdef DEBUG_MODE
+    static uint32_t lastLost = 0;
+    uint32_t lost = can.dropped() + can.overruns();
+    if (lost != lastLost) {
+        printf("CAN frames lost: %u dropped, %u overruns, queue high water mark %u\n",
+               (unsigned)can.dropped(), (unsigned)can.overruns(), (unsigned)can.highWaterMark());
+        lastLost = lost;
     }
+#endif
+}
+
+#ifdef DEBUG_MODE
+void printCanStatistics() {
+    for (int i = 0; i < (int)(sizeof(canTxChannels) / sizeof(canTxChannels[0])); i++) {
+        const CanScheduler::Statistics& stats = canScheduler.statistics(i);
+        printf("CAN tx 0x%03x: %u sent, interval %d..%d us, jitter %d us, latency %d us (max %d us)\n", canTxChannels[i].id,
+               (unsigned)stats.sent, (int)stats.minIntervalUs, (int)stats.maxIntervalUs, (int)canScheduler.jitterUs(i),
+               (int)stats.lastLatencyUs, (int)stats.maxLatencyUs);
+    }
+}
+#endif
+
+void onMotorRpm(const CANMessage& msg) {
+    // Reconstruct the integer value from the byte array
+    rpm_t rpm = (msg.data[0] << 8) | msg.data[1];
+    rpmVal.set(rpm);
+}
+
+void onGpsSpeed(const CANMessage& msg) {
+    speed_t speed_kmh = msg.data[0];
+    currentSpeedVal.set(speed_kmh);
+}
+
+void onBmsSoc(const CANMessage& msg) {
+    uint8_t socData = msg.data[4];
+    batterySocVal.set(socData / CAN_BATT_SOC_SCALING_FACTOR);
+}
+
+void onBmsVoltage(const CANMessage& msg) {
+    uint16_t voltageData = msg.data[1] | msg.data[0] << 8;
+    batteryVoltageVal.set(voltageData / CAN_BATT_VOLTAGE_SCALING_FACTOR);
+}
+
+void encodeHazardsOff(CANMessage& msg) {
+    msg.data[0] = 0x2;
+    msg.data[1] = 0x4 << 1;
+    msg.data[2] = 0x5 << 1;
+    msg.len = 3;
+}
+
+void encodeAccessories(CANMessage& msg) {
+    msg.data[0] = 0;
+    msg.data[1] = prevAccVal.value();
+    msg.len = 2;
+}
+
+void encodeThrottle(CANMessage& msg) {
+    sentThrottle = throttleVal.value();
+    msg.data[0] = sentThrottle;
+    msg.len = 1;
+}
+
+void encodeReady(CANMessage& msg) {
+    msg.data[0] = (brakeVal.value() << 2) | (dmsVal.value() << 1) | ignitionVal.value();
+    msg.len = 1;
 }
 
 void handleTime() {
-    if (!buttonState[JOYSTICK_BUTTON]) {
-        clockResetTimer.reset();
+    ButtonEvent event;
+
+    // holding the joystick button resets the clock
+    while (buttons.nextEvent(event)) {
+        if (event.button == JOYSTICK_BUTTON && event.type == ButtonEventType::LongPress)
+            clockResetTimer.reset();
     }
 
     int64_t currentTime = clockResetTimer.read_ms();
@@ -351,18 +476,15 @@ void runSteeringDisplay() {
 }
 
 void updateShiftRegs() {
-    shiftLatch.write(1);
-    for (int i = 7; i >= 0; i--) {
-        buttonState[i] = buttonIn.read();
-        shiftClk.write(1);
-        shiftClk.write(0);
-    }
-    shiftLatch.write(0);
-    for (int i = 8; i >= 0; i--) {
-        ledOut.write(!ledState[i]);
-        shiftClk.write(1);
-        shiftClk.write(0);
+    // exchange snapshots with the scanner, the registers themselves are clocked from its ticker
+    // buttonState keeps the levels of the inputs
+    uint8_t debounced = buttons.state() ^ ACTIVE_LOW_BUTTONS;
+    uint8_t leds = 0;
+    for (int i = 0; i < 8; i++) {
+        buttonState[i] = (debounced >> i) & 1;
+        leds |= ledState[i] << i;
     }
+    shiftRegs.setLeds(leds);
 }
 
 void blinkHazardLed() {
@@ -19,13 +19,39 @@
 #define IGNITION_ON_LED 5
 #define HAZARDS_LED 6
 
+//Analog inputs
+enum AdcChannel { AdcThrottle, AdcDms, AdcJoystickX, AdcJoystickY };
+
+//CAN transmit channels
+enum CanTxChannel { TxHazardsOff, TxAccessories, TxThrottle, TxReady };
+
 #include "stdio.h"
 #include "mbed.h"
 #include "SteeringDisplay.h"
 
 
 /**
- * @brief handles all accessories-related tasks
+ * @brief main thread rate group (INPUT_INTERVAL): CAN receive, throttle and CAN transmit
+ */
+void runInputGroup();
+
+/**
+ * @brief main thread rate group (CONTROL_INTERVAL): buttons, LEDs and clock
+ */
+void runControlGroup();
+
+/**
+ * @brief main thread rate group (MOTOR_CONTROLLER_TRANSMIT_INTERVAL): dms, ignition and eShift
+ */
+void runMotorGroup();
+
+/**
+ * @brief prints start lateness, execution time and overruns of every rate group, the throttle input and the CAN statistics
+ */
+void printStatistics();
+
+/**
+ * @brief handles all accessories-related tasks, rate group of its own (ACCESSORIES_TRANSMIT_INTERVAL)
  */
 void handle_accessories();
 
@@ -37,14 +63,19 @@ void handle_accessories();
 char read_accessory_inputs(char& hazardsVal);
 
 /**
- * @brief Processes current state of throttle, depending on ignition, brakes and dms.  Will send a CAN message 
- * to motor controller with throttle data, and another to telemetry indicating states of ignition, dms, etc..
+ * @brief Reads ignition, dms and the eShift joystick.  The CAN scheduler sends their states to telemetry
  * 
  */
 void handle_motor_inputs(int &eshift,int &previous_x);
 
 /**
- * @brief Read dead man's switch
+ * @brief Processes current state of throttle, depending on ignition, brakes, dms and eShift.  Triggers an immediate
+ * CAN message to the motor controller when it moves beyond the deadband
+ */
+void handle_throttle(int eshift);
+
+/**
+ * @brief Read dead man's switch, the result of the lock-in detector's last window
  * 
  * @return bool indicating whether dead man's switch is on/off
  */
@@ -63,10 +94,60 @@ unsigned char get_throttle_val();
 void runSteeringDisplay();
 
 /**
- * @brief reads incoming can messages and updates speed and battery values for display
+ * @brief programs the CAN filters from the subscription table and enables the receive interrupt
+ */
+void initializeCan();
+
+/**
+ * @brief hands all CAN messages received since the last call to their handlers
  */
 void receive_can();
 
+/**
+ * @brief CAN handler: decodes rpm from a motor controller message into rpmVal
+ */
+void onMotorRpm(const CANMessage& msg);
+
+/**
+ * @brief CAN handler: decodes speed from a telemetry gps message into currentSpeedVal
+ */
+void onGpsSpeed(const CANMessage& msg);
+
+/**
+ * @brief CAN handler: decodes battery soc from a bms pack message into batterySocVal
+ */
+void onBmsSoc(const CANMessage& msg);
+
+/**
+ * @brief CAN handler: decodes battery voltage from a bms pack message into batteryVoltageVal
+ */
+void onBmsVoltage(const CANMessage& msg);
+
+/**
+ * @brief prints the measured interval, jitter and latency of every CAN transmit channel
+ */
+void printCanStatistics();
+
+/**
+ * @brief CAN encoder: accessories operation frame which turns the hazards off
+ */
+void encodeHazardsOff(CANMessage& msg);
+
+/**
+ * @brief CAN encoder: accessories operation frame with the latest accessory inputs
+ */
+void encodeAccessories(CANMessage& msg);
+
+/**
+ * @brief CAN encoder: throttle frame for the motor controller
+ */
+void encodeThrottle(CANMessage& msg);
+
+/**
+ * @brief CAN encoder: ignition, dms and brake states
+ */
+void encodeReady(CANMessage& msg);
+
 /**
  * @brief Initializes LCD display
  * 
@@ -74,12 +155,15 @@ void receive_can();
 void initializeDisplay();
 
 /**
- * @brief checks for and handles time reset gesture
+ * @brief handles the button events: a long press of the joystick button resets the clock
  */
 void handleTime();
 
 void setLedState();
 
+/**
+ * @brief copies the debounced buttons into buttonState and hands ledState to the next shift register scan
+ */
 void updateShiftRegs();
 
 void blinkHazardLed();